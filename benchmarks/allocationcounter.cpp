@@ -0,0 +1,119 @@
+#include "allocationcounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::uint64_t> count{ 0 };
+// a plain thread local in the executable needs no allocation of its own.
+thread_local std::uint64_t threadCount = 0;
+
+void
+counted()
+{
+  count.fetch_add(1, std::memory_order_relaxed);
+  threadCount++;
+}
+
+} // end of anonymous namespace
+
+std::uint64_t
+AllocationCounter::allocations()
+{
+  return count.load(std::memory_order_relaxed);
+}
+
+std::uint64_t
+AllocationCounter::threadAllocations()
+{
+  return threadCount;
+}
+
+#if defined(__GLIBC__)
+
+// the executable's definitions take the place of the C library's for every
+// library in the process, and operator new allocates through them.
+extern "C"
+{
+  void* __libc_malloc(std::size_t size);
+  void* __libc_calloc(std::size_t count, std::size_t size);
+  void* __libc_realloc(void* pointer, std::size_t size);
+  void __libc_free(void* pointer);
+
+  void* malloc(std::size_t size)
+  {
+    counted();
+    return __libc_malloc(size);
+  }
+
+  void* calloc(std::size_t number, std::size_t size)
+  {
+    counted();
+    return __libc_calloc(number, size);
+  }
+
+  void* realloc(void* pointer, std::size_t size)
+  {
+    counted();
+    return __libc_realloc(pointer, size);
+  }
+
+  void free(void* pointer) { __libc_free(pointer); }
+}
+
+bool
+AllocationCounter::countsMalloc()
+{
+  return true;
+}
+
+#else
+
+void*
+operator new(std::size_t size)
+{
+  counted();
+  if (auto pointer = std::malloc(size ? size : 1))
+    return pointer;
+  throw std::bad_alloc();
+}
+
+void*
+operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void
+operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void
+operator delete[](void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void
+operator delete(void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+void
+operator delete[](void* pointer, std::size_t) noexcept
+{
+  std::free(pointer);
+}
+
+bool
+AllocationCounter::countsMalloc()
+{
+  return false;
+}
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+
+/*!
+  \brief Counts the heap allocations made by the whole process.
+
+  With glibc malloc() itself is replaced, so the allocations Qt makes for its
+  containers are counted as well as those made through operator new.
+  Elsewhere only operator new is counted, which misses the Qt containers.
+ */
+namespace AllocationCounter {
+
+//! Returns the number of allocations made since the process started.
+std::uint64_t
+allocations();
+
+//! Returns the number of allocations made by the calling thread since it
+//! started, which other threads do not disturb.
+std::uint64_t
+threadAllocations();
+
+//! Returns true if allocations made with malloc() are counted.
+bool
+countsMalloc();
+
+} // namespace AllocationCounter
+
+#endif // ALLOCATIONCOUNTER_H
@@ -0,0 +1,318 @@
+#include <QFile>
+#include <QtTest>
+
+#include "allocationcounter.h"
+#include "language/language_c.h"
+#include "language/languages.h"
+#include "language/unstatistical.h"
+
+/*!
+  \brief Checks that the hot paths never touch the allocator.
+
+  Lookups, validation of valid tags, display name cache hits and M49 lookups
+  must not allocate. Each check makes one call to fill any lazily built
+  tables, then counts the allocations made by this thread over many calls,
+  see AllocationCounter, and fails if there are any. It runs under ctest as
+  the language_allocations test.
+ */
+class AllocationTests : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+
+  void fromSubtag_data();
+  void fromSubtag();
+  void isSubtag_data();
+  void isSubtag();
+  void isValidTag_data();
+  void isValidTag();
+  void canonicalTag_data();
+  void canonicalTag();
+  void displayName_data();
+  void displayName();
+  void m49Lookup_data();
+  void m49Lookup();
+  void cInterface();
+
+private:
+  BCP47Languages m_languages;
+
+  static void subtagRows();
+  static void validTagRows();
+};
+
+namespace {
+
+//! Returns the allocations this thread makes in runs calls of operation,
+//! after a first call that may fill caches.
+template<typename Operation>
+std::uint64_t
+allocationsOf(Operation operation, int runs = 100)
+{
+  operation();
+  auto before = AllocationCounter::threadAllocations();
+  for (int i = 0; i < runs; i++)
+    operation();
+  return AllocationCounter::threadAllocations() - before;
+}
+
+} // end of anonymous namespace
+
+void
+AllocationTests::initTestCase()
+{
+  if (!AllocationCounter::countsMalloc())
+    qWarning("Only operator new is counted, the Qt containers are not.");
+
+  // the checked in registry is read in place of the IANA download.
+  BCP47Languages::setRegistryDownloader(
+    [](const QString& url, QString& errorStr) {
+      QFile file(url);
+      if (!file.open(QIODevice::ReadOnly)) {
+        errorStr = file.errorString();
+        return QByteArray();
+      }
+      return file.readAll();
+    });
+  m_languages.setRegistry(QStringLiteral(LANGUAGE_BENCHMARK_DATA
+                                         "/language-subtag-registry.txt"));
+  QVERIFY(!m_languages.refresh().result().isEmpty());
+}
+
+void
+AllocationTests::subtagRows()
+{
+  QTest::addColumn<int>("type");
+  QTest::addColumn<QString>("subtag");
+
+  QTest::newRow("language") << int(BCP47Language::LANGUAGE) << "fr";
+  QTest::newRow("language miss") << int(BCP47Language::LANGUAGE) << "xx";
+  QTest::newRow("extlang") << int(BCP47Language::EXTLANG) << "yue";
+  QTest::newRow("script") << int(BCP47Language::SCRIPT) << "Latn";
+  QTest::newRow("region") << int(BCP47Language::REGION) << "CA";
+  QTest::newRow("region m49") << int(BCP47Language::REGION) << "419";
+  QTest::newRow("variant") << int(BCP47Language::VARIANT) << "1901";
+  QTest::newRow("grandfathered")
+    << int(BCP47Language::GRANDFATHERED) << "i-klingon";
+  QTest::newRow("redundant") << int(BCP47Language::REDUNDANT) << "zh-Hant-TW";
+}
+
+void
+AllocationTests::fromSubtag_data()
+{
+  subtagRows();
+}
+
+void
+AllocationTests::fromSubtag()
+{
+  QFETCH(int, type);
+  QFETCH(QString, subtag);
+
+  auto operation = [this, type, &subtag]() {
+    switch (type) {
+      case BCP47Language::LANGUAGE:
+        return m_languages.languageFromSubtag(subtag);
+      case BCP47Language::EXTLANG:
+        return m_languages.extlangFromSubtag(subtag);
+      case BCP47Language::SCRIPT:
+        return m_languages.scriptFromSubtag(subtag);
+      case BCP47Language::REGION:
+        return m_languages.regionFromSubtag(subtag);
+      case BCP47Language::VARIANT:
+        return m_languages.variantFromSubtag(subtag);
+      case BCP47Language::GRANDFATHERED:
+        return m_languages.grandfatheredFromTag(subtag);
+      default:
+        return m_languages.redundantFromTag(subtag);
+    }
+  };
+  QCOMPARE(allocationsOf(operation), std::uint64_t(0));
+}
+
+void
+AllocationTests::isSubtag_data()
+{
+  subtagRows();
+}
+
+void
+AllocationTests::isSubtag()
+{
+  QFETCH(int, type);
+  QFETCH(QString, subtag);
+
+  auto operation = [this, type, &subtag]() {
+    switch (type) {
+      case BCP47Language::LANGUAGE:
+        return m_languages.isPrimaryLanguage(subtag);
+      case BCP47Language::EXTLANG:
+        return m_languages.isExtLang(subtag);
+      case BCP47Language::SCRIPT:
+        return m_languages.isScript(subtag);
+      case BCP47Language::REGION:
+        return m_languages.isRegion(subtag);
+      case BCP47Language::VARIANT:
+        return m_languages.isVariant(subtag);
+      case BCP47Language::GRANDFATHERED:
+        return m_languages.isGrandfathered(subtag);
+      default:
+        return m_languages.isRedundant(subtag);
+    }
+  };
+  QCOMPARE(allocationsOf(operation), std::uint64_t(0));
+}
+
+void
+AllocationTests::validTagRows()
+{
+  QTest::addColumn<QString>("tag");
+
+  QTest::newRow("language") << "fr";
+  QTest::newRow("language region") << "fr-CA";
+  QTest::newRow("language script region") << "zh-Hant-TW";
+  QTest::newRow("variant") << "de-DE-1996";
+  QTest::newRow("extlang") << "zh-yue";
+  QTest::newRow("private use") << "en-US-x-twain";
+  QTest::newRow("grandfathered") << "i-klingon";
+}
+
+void
+AllocationTests::isValidTag_data()
+{
+  validTagRows();
+  QTest::newRow("mixed case") << "ZH-hant-tw";
+}
+
+void
+AllocationTests::isValidTag()
+{
+  QFETCH(QString, tag);
+
+  QVERIFY(m_languages.isValidTag(tag));
+  auto operation = [this, &tag]() { return m_languages.isValidTag(tag); };
+  QCOMPARE(allocationsOf(operation), std::uint64_t(0));
+}
+
+void
+AllocationTests::canonicalTag_data()
+{
+  // only a tag that is already canonical can be returned without a copy.
+  QTest::addColumn<QString>("tag");
+
+  QTest::newRow("language region") << "fr-CA";
+  QTest::newRow("language script region") << "zh-Hant-TW";
+  QTest::newRow("variant") << "de-DE-1996";
+}
+
+void
+AllocationTests::canonicalTag()
+{
+  QFETCH(QString, tag);
+
+  QCOMPARE(m_languages.canonicalTag(tag), tag);
+  auto operation = [this, &tag]() { return m_languages.canonicalTag(tag); };
+  QCOMPARE(allocationsOf(operation), std::uint64_t(0));
+}
+
+void
+AllocationTests::displayName_data()
+{
+  QTest::addColumn<QString>("tag");
+  QTest::addColumn<int>("language");
+
+  QTest::newRow("fr-CA English") << "fr-CA" << int(UNStatisticalCodes::English);
+  QTest::newRow("fr-CA French") << "fr-CA" << int(UNStatisticalCodes::French);
+  QTest::newRow("zh-Hant-TW Russian")
+    << "zh-Hant-TW" << int(UNStatisticalCodes::Russian);
+}
+
+void
+AllocationTests::displayName()
+{
+  QFETCH(QString, tag);
+  QFETCH(int, language);
+
+  // the first call composes and caches the name, the rest are cache hits.
+  auto displayLanguage = UNStatisticalCodes::Language(language);
+  auto operation = [this, &tag, displayLanguage]() {
+    return m_languages.displayName(tag, displayLanguage);
+  };
+  QCOMPARE(allocationsOf(operation), std::uint64_t(0));
+}
+
+void
+AllocationTests::m49Lookup_data()
+{
+  QTest::addColumn<int>("lookup");
+
+  QTest::newRow("m49ForRegion") << 0;
+  QTest::newRow("regionForM49") << 1;
+  QTest::newRow("alpha3ForRegion") << 2;
+  QTest::newRow("regionContains") << 3;
+  QTest::newRow("UN name") << 4;
+  QTest::newRow("UN alphaCode") << 5;
+  QTest::newRow("UN m49FromAlphaCode") << 6;
+  QTest::newRow("UN findName") << 7;
+  QTest::newRow("UN regionContains") << 8;
+}
+
+void
+AllocationTests::m49Lookup()
+{
+  QFETCH(int, lookup);
+
+  auto& codes = UNStatisticalCodes::instance();
+  auto canada = QStringLiteral("CA");
+  auto americas = QStringLiteral("419");
+  auto southAmerica = QStringLiteral("005");
+  auto alpha3 = QStringLiteral("CAN");
+  auto name = QStringLiteral("Canada");
+  auto operation = [&]() {
+    switch (lookup) {
+      case 0:
+        return m_languages.m49ForRegion(canada);
+      case 1:
+        return int(m_languages.regionForM49(124).size());
+      case 2:
+        return int(m_languages.alpha3ForRegion(canada).size());
+      case 3:
+        return int(m_languages.regionContains(americas, southAmerica));
+      case 4:
+        return int(codes.name(UNStatisticalCodes::French, 124).size());
+      case 5:
+        return int(codes.alphaCode(124).size());
+      case 6:
+        return codes.m49FromAlphaCode(alpha3);
+      case 7:
+        return codes.findName(name).m49();
+      default:
+        return int(codes.regionContains(419, 5));
+    }
+  };
+  QCOMPARE(allocationsOf(operation), std::uint64_t(0));
+}
+
+void
+AllocationTests::cInterface()
+{
+  auto snapshot = lang_snapshot_current();
+  QVERIFY(snapshot);
+  const char tag[] = "zh-Hant-TW";
+  char out[32];
+  auto operation = [snapshot, &tag, &out]() {
+    lang_result result;
+    lang_record record;
+    lang_validate(snapshot, tag, sizeof(tag) - 1, &result);
+    lang_lookup(snapshot, LANG_TYPE_SCRIPT, "hant", 4, &record);
+    return lang_canonicalize(snapshot, tag, sizeof(tag) - 1, out, sizeof(out));
+  };
+  auto allocations = allocationsOf(operation);
+  lang_snapshot_release(snapshot);
+  QCOMPARE(allocations, std::uint64_t(0));
+}
+
+QTEST_GUILESS_MAIN(AllocationTests)
+#include "allocationtests.moc"
@@ -0,0 +1,605 @@
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#include <algorithm>
+#include <functional>
+
+#include "allocationcounter.h"
+#include "language/languages.h"
+#include "language/unstatistical.h"
+#include "registrygenerator.h"
+
+/*!
+  \brief Benchmarks of the registry parsing, lookups, validation and UN M49
+  lookups.
+
+  Every benchmark runs on the registry excerpt in data/, so the results only
+  change when the code does. Along with the time per call reported by QTest,
+  each benchmark prints the heap allocations per call, see AllocationCounter.
+
+  The scaling benchmarks repeat the parse, load, save and lookups on
+  synthetic registries, see RegistryGenerator, at each of the sizes listed in
+  LANGUAGE_BENCHMARK_SCALES, by default "1,10" times the IANA registry. They
+  run last as they publish the synthetic registries.
+
+  Run with -tickcounter or -perf for steadier numbers than the wall clock.
+ */
+class LanguageBenchmarks : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+
+  void parse();
+  void loadYamlFile();
+  void saveToLocalFile();
+  void buildSnapshot();
+
+  void fromSubtag_data();
+  void fromSubtag();
+  void isSubtag_data();
+  void isSubtag();
+  void testTag_data();
+  void testTag();
+  void typeFromString_data();
+  void typeFromString();
+  void isValidTag_data();
+  void isValidTag();
+  void canonicalTag_data();
+  void canonicalTag();
+  void displayName_data();
+  void displayName();
+
+  void unName_data();
+  void unName();
+  void unFindName_data();
+  void unFindName();
+  void unAlphaCode();
+  void unM49FromAlphaCode();
+  void unRegionContains();
+
+  void scaling_data();
+  void scaling();
+
+private:
+  //! The operations measured by scaling().
+  enum ScaledOperation
+  {
+    Parse,
+    Build,
+    Load,
+    Save,
+    Lookup,
+    Validate,
+  };
+
+  BCP47Languages m_languages;
+  QByteArray m_registry;
+  QTemporaryDir m_dir;
+  QString m_yamlFile;
+  int m_touches = 0;
+  QHash<int, QByteArray> m_generated;
+  int m_publishedScale = 0;
+  int m_publishes = 0;
+  QString m_scaledSubtag;
+  QString m_scaledTag;
+
+  void touchAndLoad(const QString& filename);
+  bool publishScale(int scale);
+  static void subtagRows();
+  static void tagRows();
+  static void drainEvents();
+};
+
+namespace {
+
+//! Runs the operation runs times, after one warm up call, and prints the heap
+//! allocations made per call.
+template<typename Operation>
+void
+reportAllocations(Operation operation, int runs = 1000)
+{
+  operation();
+  auto before = AllocationCounter::allocations();
+  for (int i = 0; i < runs; i++)
+    operation();
+  auto count = AllocationCounter::allocations() - before;
+  auto tag = QTest::currentDataTag();
+  qInfo("%s(%s): %.2f allocations/op%s",
+        QTest::currentTestFunction(),
+        tag ? tag : "",
+        double(count) / runs,
+        AllocationCounter::countsMalloc() ? "" : " (operator new only)");
+}
+
+} // end of anonymous namespace
+
+void
+LanguageBenchmarks::initTestCase()
+{
+  auto registry = QStringLiteral(LANGUAGE_BENCHMARK_DATA
+                                 "/language-subtag-registry.txt");
+  QFile file(registry);
+  QVERIFY(file.open(QIODevice::ReadOnly));
+  m_registry = file.readAll();
+  QVERIFY(m_dir.isValid());
+  m_yamlFile = m_dir.filePath(QStringLiteral("languages.yaml"));
+
+  // the checked in registry is read in place of the IANA download.
+  BCP47Languages::setRegistryDownloader(
+    [](const QString& url, QString& errorStr) {
+      QFile file(url);
+      if (!file.open(QIODevice::ReadOnly)) {
+        errorStr = file.errorString();
+        return QByteArray();
+      }
+      return file.readAll();
+    });
+  m_languages.setRegistry(registry);
+  auto snapshot = m_languages.refresh().result();
+  drainEvents();
+  QVERIFY(!snapshot.isEmpty());
+  m_languages.saveToLocalFile(m_yamlFile);
+}
+
+void
+LanguageBenchmarks::parse()
+{
+  auto operation = [this]() {
+    LanguageParser parser;
+    parser.setData(m_registry);
+    parser.parse();
+  };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation, 20);
+}
+
+void
+LanguageBenchmarks::loadYamlFile()
+{
+  auto operation = [this]() { touchAndLoad(m_yamlFile); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation, 20);
+  drainEvents();
+}
+
+void
+LanguageBenchmarks::saveToLocalFile()
+{
+  auto filename = m_dir.filePath(QStringLiteral("saved.yaml"));
+  auto operation = [this, filename]() {
+    m_languages.saveToLocalFile(filename);
+  };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation, 20);
+}
+
+void
+LanguageBenchmarks::buildSnapshot()
+{
+  auto snapshot = BCP47Languages::snapshot();
+  auto dataset = snapshot.dataset();
+  auto fileDate = snapshot.fileDate();
+  auto operation = [&dataset, &fileDate]() {
+    BCP47Snapshot::build(dataset, fileDate);
+  };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation, 20);
+}
+
+void
+LanguageBenchmarks::subtagRows()
+{
+  QTest::addColumn<int>("type");
+  QTest::addColumn<QString>("subtag");
+
+  QTest::newRow("language") << int(BCP47Language::LANGUAGE) << "fr";
+  QTest::newRow("language miss") << int(BCP47Language::LANGUAGE) << "xx";
+  QTest::newRow("extlang") << int(BCP47Language::EXTLANG) << "yue";
+  QTest::newRow("script") << int(BCP47Language::SCRIPT) << "Latn";
+  QTest::newRow("region") << int(BCP47Language::REGION) << "CA";
+  QTest::newRow("region m49") << int(BCP47Language::REGION) << "419";
+  QTest::newRow("variant") << int(BCP47Language::VARIANT) << "1901";
+  QTest::newRow("grandfathered")
+    << int(BCP47Language::GRANDFATHERED) << "i-klingon";
+  QTest::newRow("redundant") << int(BCP47Language::REDUNDANT) << "zh-Hant-TW";
+}
+
+void
+LanguageBenchmarks::fromSubtag_data()
+{
+  subtagRows();
+}
+
+void
+LanguageBenchmarks::fromSubtag()
+{
+  QFETCH(int, type);
+  QFETCH(QString, subtag);
+
+  auto operation = [this, type, &subtag]() {
+    switch (type) {
+      case BCP47Language::LANGUAGE:
+        return m_languages.languageFromSubtag(subtag);
+      case BCP47Language::EXTLANG:
+        return m_languages.extlangFromSubtag(subtag);
+      case BCP47Language::SCRIPT:
+        return m_languages.scriptFromSubtag(subtag);
+      case BCP47Language::REGION:
+        return m_languages.regionFromSubtag(subtag);
+      case BCP47Language::VARIANT:
+        return m_languages.variantFromSubtag(subtag);
+      case BCP47Language::GRANDFATHERED:
+        return m_languages.grandfatheredFromTag(subtag);
+      default:
+        return m_languages.redundantFromTag(subtag);
+    }
+  };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::isSubtag_data()
+{
+  subtagRows();
+}
+
+void
+LanguageBenchmarks::isSubtag()
+{
+  QFETCH(int, type);
+  QFETCH(QString, subtag);
+
+  auto operation = [this, type, &subtag]() {
+    switch (type) {
+      case BCP47Language::LANGUAGE:
+        return m_languages.isPrimaryLanguage(subtag);
+      case BCP47Language::EXTLANG:
+        return m_languages.isExtLang(subtag);
+      case BCP47Language::SCRIPT:
+        return m_languages.isScript(subtag);
+      case BCP47Language::REGION:
+        return m_languages.isRegion(subtag);
+      case BCP47Language::VARIANT:
+        return m_languages.isVariant(subtag);
+      case BCP47Language::GRANDFATHERED:
+        return m_languages.isGrandfathered(subtag);
+      default:
+        return m_languages.isRedundant(subtag);
+    }
+  };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::tagRows()
+{
+  QTest::addColumn<QString>("tag");
+
+  QTest::newRow("language") << "fr";
+  QTest::newRow("language region") << "fr-CA";
+  QTest::newRow("language script region") << "zh-Hant-TW";
+  QTest::newRow("variant") << "de-DE-1996";
+  QTest::newRow("extlang") << "zh-yue-HK";
+  QTest::newRow("private use") << "en-US-x-twain";
+  QTest::newRow("grandfathered") << "i-klingon";
+  QTest::newRow("mixed case") << "ZH-hant-tw";
+  QTest::newRow("bad") << "not a tag";
+}
+
+void
+LanguageBenchmarks::testTag_data()
+{
+  tagRows();
+}
+
+void
+LanguageBenchmarks::testTag()
+{
+  QFETCH(QString, tag);
+
+  // testTag() may change the tag, so each call gets its own copy.
+  auto operation = [this, &tag]() {
+    auto value = tag;
+    m_languages.testTag(value);
+  };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::typeFromString_data()
+{
+  QTest::addColumn<QString>("value");
+
+  QTest::newRow("language") << "language";
+  QTest::newRow("redundant") << "redundant";
+  QTest::newRow("unknown") << "unknown";
+}
+
+void
+LanguageBenchmarks::typeFromString()
+{
+  QFETCH(QString, value);
+
+  auto operation = [this, &value]() { m_languages.typeFromString(value); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::isValidTag_data()
+{
+  tagRows();
+}
+
+void
+LanguageBenchmarks::isValidTag()
+{
+  QFETCH(QString, tag);
+
+  auto operation = [this, &tag]() { m_languages.isValidTag(tag); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::canonicalTag_data()
+{
+  tagRows();
+}
+
+void
+LanguageBenchmarks::canonicalTag()
+{
+  QFETCH(QString, tag);
+
+  auto operation = [this, &tag]() { m_languages.canonicalTag(tag); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::displayName_data()
+{
+  QTest::addColumn<QString>("tag");
+  QTest::addColumn<int>("language");
+
+  QTest::newRow("fr-CA English") << "fr-CA" << int(UNStatisticalCodes::English);
+  QTest::newRow("fr-CA French") << "fr-CA" << int(UNStatisticalCodes::French);
+  QTest::newRow("zh-Hant-TW Russian")
+    << "zh-Hant-TW" << int(UNStatisticalCodes::Russian);
+  QTest::newRow("de-DE-1996 Arabic")
+    << "de-DE-1996" << int(UNStatisticalCodes::Arabic);
+}
+
+void
+LanguageBenchmarks::displayName()
+{
+  QFETCH(QString, tag);
+  QFETCH(int, language);
+
+  // the warm up call composes the name, so this measures the cache hit.
+  auto displayLanguage = UNStatisticalCodes::Language(language);
+  auto operation = [this, &tag, displayLanguage]() {
+    m_languages.displayName(tag, displayLanguage);
+  };
+  operation();
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::unName_data()
+{
+  QTest::addColumn<int>("language");
+  QTest::addColumn<int>("m49");
+
+  QTest::newRow("English Canada") << int(UNStatisticalCodes::English) << 124;
+  QTest::newRow("Chinese Europe") << int(UNStatisticalCodes::Chinese) << 150;
+}
+
+void
+LanguageBenchmarks::unName()
+{
+  QFETCH(int, language);
+  QFETCH(int, m49);
+
+  auto& codes = UNStatisticalCodes::instance();
+  auto lang = UNStatisticalCodes::Language(language);
+  auto operation = [&codes, lang, m49]() { codes.name(lang, m49); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::unFindName_data()
+{
+  QTest::addColumn<QString>("name");
+  QTest::addColumn<int>("matching");
+
+  QTest::newRow("exact") << "Canada" << int(UNStatisticalCodes::ExactMatch);
+  QTest::newRow("normalised")
+    << "CÔTE D'IVOIRE" << int(UNStatisticalCodes::NormalisedMatch);
+  QTest::newRow("miss") << "Atlantis" << int(UNStatisticalCodes::ExactMatch);
+}
+
+void
+LanguageBenchmarks::unFindName()
+{
+  QFETCH(QString, name);
+  QFETCH(int, matching);
+
+  auto& codes = UNStatisticalCodes::instance();
+  auto match = UNStatisticalCodes::NameMatching(matching);
+  auto operation = [&codes, &name, match]() { codes.findName(name, match); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::unAlphaCode()
+{
+  auto& codes = UNStatisticalCodes::instance();
+  auto operation = [&codes]() { codes.alphaCode(124); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::unM49FromAlphaCode()
+{
+  auto& codes = UNStatisticalCodes::instance();
+  auto alpha3 = QStringLiteral("CAN");
+  auto operation = [&codes, &alpha3]() { codes.m49FromAlphaCode(alpha3); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::unRegionContains()
+{
+  // Latin America and the Caribbean contains South America.
+  auto& codes = UNStatisticalCodes::instance();
+  auto operation = [&codes]() { codes.regionContains(419, 5); };
+  QBENCHMARK { operation(); }
+  reportAllocations(operation);
+}
+
+void
+LanguageBenchmarks::scaling_data()
+{
+  QTest::addColumn<int>("scale");
+  QTest::addColumn<int>("operation");
+
+  QVector<int> scales;
+  auto list = qEnvironmentVariable("LANGUAGE_BENCHMARK_SCALES", "1,10");
+  for (auto& value : list.split(',', Qt::SkipEmptyParts)) {
+    auto scale = value.trimmed().toInt();
+    if (scale > 0)
+      scales.append(scale);
+  }
+  // each size is published once, and a later publish needs a newer file date,
+  // so every operation of one size runs before the next size.
+  std::sort(scales.begin(), scales.end());
+  const char* names[] = { "parse", "build", "load", "save", "lookup",
+                          "validate" };
+  for (auto scale : scales) {
+    for (int operation = Parse; operation <= Validate; operation++)
+      QTest::addRow("%dx %s", scale, names[operation])
+        << scale << operation;
+  }
+}
+
+void
+LanguageBenchmarks::scaling()
+{
+  QFETCH(int, scale);
+  QFETCH(int, operation);
+  QVERIFY(publishScale(scale));
+
+  auto registry = m_generated.value(scale);
+  auto snapshot = BCP47Languages::snapshot();
+  auto yamlFile = m_dir.filePath(QStringLiteral("scaled.yaml"));
+  auto savedFile = m_dir.filePath(QStringLiteral("scaled-saved.yaml"));
+  std::function<void()> run;
+  switch (operation) {
+    case Parse:
+      run = [&registry]() {
+        LanguageParser parser;
+        parser.setData(registry);
+        parser.parse();
+      };
+      break;
+    case Build:
+      run = [&snapshot]() {
+        BCP47Snapshot::build(snapshot.dataset(), snapshot.fileDate());
+      };
+      break;
+    case Load:
+      run = [this, &yamlFile]() { touchAndLoad(yamlFile); };
+      break;
+    case Save:
+      run = [this, &savedFile]() { m_languages.saveToLocalFile(savedFile); };
+      break;
+    case Lookup:
+      run = [this]() { m_languages.languageFromSubtag(m_scaledSubtag); };
+      break;
+    default:
+      run = [this]() { m_languages.isValidTag(m_scaledTag); };
+      break;
+  }
+  QBENCHMARK { run(); }
+  reportAllocations(run, operation >= Lookup ? 1000 : 3);
+  drainEvents();
+}
+
+void
+LanguageBenchmarks::touchAndLoad(const QString& filename)
+{
+  // a file is only read again once its modification time changes.
+  QFile file(filename);
+  if (file.open(QIODevice::ReadWrite))
+    file.setFileTime(QDateTime::currentDateTime().addSecs(++m_touches),
+                     QFileDevice::FileModificationTime);
+  file.close();
+  m_languages.load(filename).waitForFinished();
+}
+
+bool
+LanguageBenchmarks::publishScale(int scale)
+{
+  if (scale == m_publishedScale)
+    return true;
+  if (!m_generated.contains(scale))
+    m_generated.insert(scale, RegistryGenerator(scale).generate());
+
+  // every publish needs a newer file date than the last.
+  RegistryGenerator generator(scale);
+  auto registry = m_generated.value(scale);
+  auto fileDate = generator.fileDate().addDays(++m_publishes);
+  registry.replace(0,
+                   registry.indexOf('\n'),
+                   "File-Date: " + fileDate.toString(Qt::ISODate).toLatin1());
+  auto filename = m_dir.filePath(QStringLiteral("scaled.txt"));
+  QFile file(filename);
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate) ||
+      file.write(registry) != registry.size())
+    return false;
+  file.close();
+
+  m_languages.setRegistry(filename);
+  auto snapshot = m_languages.refresh().result();
+  drainEvents();
+  if (snapshot.fileDate() != fileDate)
+    return false;
+  m_languages.saveToLocalFile(m_dir.filePath(QStringLiteral("scaled.yaml")));
+
+  // a subtag and a tag from the middle of the registry.
+  auto middle = [&snapshot](BCP47Language::Type type) {
+    auto subtags = snapshot.subtags(type);
+    return subtags.isEmpty() ? QString() : subtags.at(subtags.size() / 2);
+  };
+  m_scaledSubtag = middle(BCP47Language::LANGUAGE);
+  m_scaledTag = m_scaledSubtag + '-' + middle(BCP47Language::SCRIPT) + '-' +
+                middle(BCP47Language::REGION);
+  m_publishedScale = scale;
+  return true;
+}
+
+void
+LanguageBenchmarks::drainEvents()
+{
+  // the futures report through queued signals and free their watchers later.
+  QCoreApplication::processEvents();
+  QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+QTEST_GUILESS_MAIN(LanguageBenchmarks)
+#include "languagebenchmarks.moc"
@@ -0,0 +1,386 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "language/language_c.h"
+#include "language/languages.h"
+#include "language/unstatistical.h"
+
+/*
+  Times the main workloads of the library against a stored baseline and fails
+  if any of them has become slower than its tolerance allows.
+
+  The baseline is a JSON file of nanoseconds per operation for each workload,
+  recorded on the machine that runs the gate, as the numbers of one machine
+  mean nothing on another. A baseline is only written by a run with
+  --record, a run without one fails rather than passing unchecked. Each
+  measurement is the median of several samples, which keeps a single
+  descheduled sample from failing the run. The results, with the baseline, ratio and status of each workload, are
+  written as JSON so the numbers can be tracked over time.
+
+  Exits with 0 if every workload is within its tolerance, 1 if any regressed,
+  2 if the gate could not run and 3 if there is no baseline to compare with.
+*/
+
+namespace {
+
+//! The exit status when there is no baseline, which ctest reports as skipped.
+const int NO_BASELINE = 3;
+
+//! A timed workload, each call of run is one operation.
+struct Workload
+{
+  QString name;
+  int iterations;
+  std::function<void()> run;
+};
+
+//! The measurement of a workload, compared with its baseline.
+struct Result
+{
+  QString name;
+  double nsPerOp = 0;
+  double baseline = 0;
+  double tolerance = 0;
+  QString status;
+};
+
+void
+drainEvents()
+{
+  // the futures report through queued signals and free their watchers later.
+  QCoreApplication::processEvents();
+  QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+//! Returns the median time per operation of samples runs of the workload,
+//! after one untimed run.
+double
+measure(const Workload& workload, int samples)
+{
+  for (int i = 0; i < workload.iterations; i++)
+    workload.run();
+  std::vector<double> times;
+  QElapsedTimer timer;
+  for (int sample = 0; sample < samples; sample++) {
+    timer.start();
+    for (int i = 0; i < workload.iterations; i++)
+      workload.run();
+    times.push_back(double(timer.nsecsElapsed()) / workload.iterations);
+  }
+  std::sort(times.begin(), times.end());
+  return times[times.size() / 2];
+}
+
+QJsonObject
+readJson(const QString& filename, QString& errorStr)
+{
+  QFile file(filename);
+  if (!file.open(QIODevice::ReadOnly)) {
+    errorStr = file.errorString();
+    return QJsonObject();
+  }
+  QJsonParseError error;
+  auto document = QJsonDocument::fromJson(file.readAll(), &error);
+  if (!document.isObject())
+    errorStr = error.errorString();
+  return document.object();
+}
+
+bool
+writeJson(const QString& filename, const QJsonObject& object)
+{
+  QFile file(filename);
+  if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    return false;
+  return file.write(QJsonDocument(object).toJson()) >= 0;
+}
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("language_perfgate");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription(
+    "Fails if the language library is slower than its recorded baseline.");
+  parser.addHelpOption();
+  QCommandLineOption baselineOption(
+    { "b", "baseline" }, "The baseline file.", "file", "perf-baseline.json");
+  QCommandLineOption outputOption({ "o", "output" },
+                                  "The file the results are written to.",
+                                  "file",
+                                  "perf-results.json");
+  QCommandLineOption registryOption(
+    "registry",
+    "The registry the workloads run on.",
+    "file",
+    QStringLiteral(LANGUAGE_BENCHMARK_DATA "/language-subtag-registry.txt"));
+  QCommandLineOption toleranceOption(
+    { "t", "tolerance" },
+    "The slowdown allowed, in percent, where the baseline sets none.",
+    "percent",
+    "25");
+  QCommandLineOption samplesOption(
+    "samples", "The samples taken of each workload.", "count", "7");
+  QCommandLineOption recordOption(
+    "record", "Writes the measurements to the baseline file and passes.");
+  parser.addOption(baselineOption);
+  parser.addOption(outputOption);
+  parser.addOption(registryOption);
+  parser.addOption(toleranceOption);
+  parser.addOption(samplesOption);
+  parser.addOption(recordOption);
+  parser.process(app);
+
+  QTextStream err(stderr);
+  bool toleranceOk, samplesOk;
+  auto defaultTolerance = parser.value(toleranceOption).toDouble(&toleranceOk);
+  auto samples = parser.value(samplesOption).toInt(&samplesOk);
+  if (!toleranceOk || defaultTolerance < 0 || !samplesOk || samples < 1) {
+    err << "The tolerance or sample count is not valid.\n";
+    return 2;
+  }
+  defaultTolerance /= 100;
+
+  auto record = parser.isSet(recordOption);
+  auto baselineFile = parser.value(baselineOption);
+  QString errorStr;
+  QJsonObject baseline;
+  if (QFile::exists(baselineFile)) {
+    baseline = readJson(baselineFile, errorStr);
+    if (!errorStr.isEmpty()) {
+      err << baselineFile << ": " << errorStr << "\n";
+      return 2;
+    }
+  } else if (!record) {
+    err << baselineFile
+        << " does not exist, record one with --record first.\n";
+    return NO_BASELINE;
+  }
+
+  QFile registryFile(parser.value(registryOption));
+  if (!registryFile.open(QIODevice::ReadOnly)) {
+    err << registryFile.fileName() << ": " << registryFile.errorString()
+        << "\n";
+    return 2;
+  }
+  auto registry = registryFile.readAll();
+  QTemporaryDir dir;
+  if (!dir.isValid()) {
+    err << "A temporary directory could not be made.\n";
+    return 2;
+  }
+
+  // each refresh publishes a copy of the registry with a newer file date.
+  auto refreshFile = dir.filePath(QStringLiteral("registry.txt"));
+  auto fileDate = QDate(2000, 1, 1);
+  auto writeRegistry = [&registry, &refreshFile, &fileDate]() {
+    fileDate = fileDate.addDays(1);
+    auto data = registry;
+    data.replace(0,
+                 data.indexOf('\n'),
+                 "File-Date: " + fileDate.toString(Qt::ISODate).toLatin1());
+    QFile file(refreshFile);
+    return file.open(QIODevice::WriteOnly | QIODevice::Truncate) &&
+           file.write(data) == data.size();
+  };
+
+  BCP47Languages::setRegistryDownloader(
+    [](const QString& url, QString& errorStr) {
+      QFile file(url);
+      if (!file.open(QIODevice::ReadOnly)) {
+        errorStr = file.errorString();
+        return QByteArray();
+      }
+      return file.readAll();
+    });
+  BCP47Languages languages;
+  languages.setRegistry(refreshFile);
+  if (!writeRegistry() || languages.refresh().result().isEmpty()) {
+    err << "The registry could not be loaded.\n";
+    return 2;
+  }
+  drainEvents();
+  auto yamlFile = dir.filePath(QStringLiteral("languages.yaml"));
+  languages.saveToLocalFile(yamlFile);
+
+  const QVector<QString> tags = { "fr",         "fr-CA",         "zh-Hant-TW",
+                                  "de-DE-1996", "en-US-x-twain", "i-klingon",
+                                  "ZH-hant-tw", "not a tag" };
+  QVector<QByteArray> utf8Tags;
+  std::vector<lang_string> batch;
+  for (auto& tag : tags)
+    utf8Tags.append(tag.toUtf8());
+  for (auto& tag : utf8Tags)
+    batch.push_back({ tag.constData(), std::size_t(tag.size()) });
+  std::vector<lang_result> batchResults(batch.size());
+  auto snapshot = lang_snapshot_current();
+
+  int touches = 0;
+  int next = 0;
+  auto& codes = UNStatisticalCodes::instance();
+  const QString region = "CA";
+  const QString alpha3 = "CAN";
+  const std::vector<Workload> workloads = {
+    // the parse and full index build of a process starting from the
+    // registry.
+    { "cold_start",
+      5,
+      [&registry]() {
+        QMultiMap<QString, QSharedPointer<BCP47Language>> dataset;
+        QDate date;
+        LanguageParser parser;
+        QObject::connect(
+          &parser,
+          &LanguageParser::parseCompleted,
+          [&dataset, &date](
+            QMultiMap<QString, QSharedPointer<BCP47Language>> languages,
+            QDate fileDate,
+            bool) {
+            dataset = languages;
+            date = fileDate;
+          });
+        parser.setData(registry);
+        parser.parse();
+        BCP47Snapshot::build(dataset, date);
+      } },
+    // a file is only read again once its modification time changes.
+    { "load_local_file",
+      5,
+      [&languages, &yamlFile, &touches]() {
+        QFile file(yamlFile);
+        if (file.open(QIODevice::ReadWrite))
+          file.setFileTime(QDateTime::currentDateTime().addSecs(++touches),
+                           QFileDevice::FileModificationTime);
+        file.close();
+        languages.load(yamlFile).waitForFinished();
+        drainEvents();
+      } },
+    // the download, parse and incremental update of a newer registry.
+    { "refresh",
+      5,
+      [&languages, &writeRegistry]() {
+        writeRegistry();
+        languages.refresh().waitForFinished();
+        drainEvents();
+      } },
+    { "validate",
+      1000,
+      [&languages, &tags, &next]() {
+        languages.isValidTag(tags.at(next++ % tags.size()));
+      } },
+    // one operation validates every tag.
+    { "validate_batch",
+      1000,
+      [snapshot, &batch, &batchResults]() {
+        lang_validate_batch(
+          snapshot, batch.data(), batch.size(), batchResults.data());
+      } },
+    { "lookup_subtag",
+      10000,
+      [&languages]() {
+        languages.languageFromSubtag(QStringLiteral("fr"));
+        languages.scriptFromSubtag(QStringLiteral("Latn"));
+        languages.regionFromSubtag(QStringLiteral("CA"));
+      } },
+    { "lookup_m49",
+      10000,
+      [&languages, &codes, &region, &alpha3]() {
+        languages.m49ForRegion(region);
+        codes.m49FromAlphaCode(alpha3);
+        codes.regionContains(419, 5);
+      } },
+  };
+
+  auto baselineWorkloads = baseline.value("workloads").toObject();
+  auto passed = true;
+  QVector<Result> results;
+  for (auto& workload : workloads) {
+    Result result;
+    result.name = workload.name;
+    result.nsPerOp = measure(workload, samples);
+    auto expected = baselineWorkloads.value(workload.name).toObject();
+    result.baseline = expected.value("nsPerOp").toDouble();
+    result.tolerance = expected.value("tolerance").toDouble(defaultTolerance);
+    if (result.baseline <= 0) {
+      result.status = "new";
+    } else if (result.nsPerOp > result.baseline * (1 + result.tolerance)) {
+      result.status = "regressed";
+      passed = false;
+    } else if (result.nsPerOp < result.baseline * (1 - result.tolerance)) {
+      // a speedup beyond the tolerance should be recorded as the baseline.
+      result.status = "improved";
+    } else {
+      result.status = "ok";
+    }
+    err << QString("%1 %2 ns/op")
+             .arg(workload.name, -16)
+             .arg(result.nsPerOp, 12, 'f', 1);
+    if (result.baseline > 0)
+      err << QString(" (baseline %1, %2%)")
+               .arg(result.baseline, 0, 'f', 1)
+               .arg(100 * (result.nsPerOp / result.baseline - 1), 0, 'f', 1);
+    err << " " << result.status << "\n";
+    results.append(result);
+  }
+  lang_snapshot_release(snapshot);
+
+  QJsonArray resultArray;
+  QJsonObject recorded;
+  for (auto& result : results) {
+    QJsonObject object;
+    object.insert("name", result.name);
+    object.insert("nsPerOp", result.nsPerOp);
+    object.insert("tolerance", result.tolerance);
+    object.insert("status", result.status);
+    if (result.baseline > 0) {
+      object.insert("baseline", result.baseline);
+      object.insert("ratio", result.nsPerOp / result.baseline);
+    }
+    resultArray.append(object);
+
+    // a recorded baseline keeps any tolerance set by hand.
+    auto entry = baselineWorkloads.value(result.name).toObject();
+    entry.insert("nsPerOp", result.nsPerOp);
+    recorded.insert(result.name, entry);
+  }
+  QJsonObject output;
+  output.insert("timestamp",
+                QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+  output.insert("qtVersion", QString(qVersion()));
+  output.insert("registry", registryFile.fileName());
+  output.insert("samples", samples);
+  output.insert("passed", record || passed);
+  output.insert("workloads", resultArray);
+  auto outputFile = parser.value(outputOption);
+  if (!writeJson(outputFile, output)) {
+    err << outputFile << " could not be written.\n";
+    return 2;
+  }
+
+  if (record) {
+    baseline.insert("workloads", recorded);
+    if (!writeJson(baselineFile, baseline)) {
+      err << baselineFile << " could not be written.\n";
+      return 2;
+    }
+    err << "Baseline recorded in " << baselineFile << ".\n";
+    return 0;
+  }
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+#include <QFile>
+#include <QtTest>
+
+#include "language/languages.h"
+#include "language/unstatistical.h"
+
+/*!
+  \brief Checks the join of the region subtags to the UN M49 codes.
+
+  Every current region subtag of the checked in registry, other than the
+  private use ones, must have an M49 code. The regions whose IANA and UN
+  names differ are checked by name, as those are the ones a join by name
+  would miss.
+ */
+class RegionTests : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+
+  void everyRegionHasM49();
+  void registryRegions_data();
+  void registryRegions();
+  void alpha2Codes_data();
+  void alpha2Codes();
+
+private:
+  BCP47Languages m_languages;
+};
+
+void
+RegionTests::initTestCase()
+{
+  // the checked in registry is read in place of the IANA download.
+  BCP47Languages::setRegistryDownloader(
+    [](const QString& url, QString& errorStr) {
+      QFile file(url);
+      if (!file.open(QIODevice::ReadOnly)) {
+        errorStr = file.errorString();
+        return QByteArray();
+      }
+      return file.readAll();
+    });
+  m_languages.setRegistry(QStringLiteral(LANGUAGE_BENCHMARK_DATA
+                                         "/language-subtag-registry.txt"));
+  QVERIFY(!m_languages.refresh().result().isEmpty());
+}
+
+void
+RegionTests::everyRegionHasM49()
+{
+  auto snapshot = BCP47Languages::snapshot();
+  auto regions = snapshot.subtags(BCP47Language::REGION);
+  QVERIFY(!regions.isEmpty());
+  for (auto& subtag : regions) {
+    auto region = snapshot.fromSubtag(BCP47Language::REGION, subtag);
+    if (subtag.contains(QStringLiteral("..")) || region->isDeprecated() ||
+        m_languages.checkRegion(subtag) == BCP47Language::PRIVATE_REGION)
+      continue;
+    QVERIFY2(m_languages.m49ForRegion(subtag) >= 0, qPrintable(subtag));
+  }
+}
+
+void
+RegionTests::registryRegions_data()
+{
+  QTest::addColumn<QString>("subtag");
+  QTest::addColumn<int>("m49");
+  QTest::addColumn<QString>("alpha3");
+
+  QTest::newRow("CA") << "CA" << 124 << "CAN";
+  QTest::newRow("US") << "US" << 840 << "USA";
+  QTest::newRow("GB") << "GB" << 826 << "GBR";
+  QTest::newRow("KR") << "KR" << 410 << "KOR";
+  QTest::newRow("HK") << "HK" << 344 << "HKG";
+  QTest::newRow("RU") << "RU" << 643 << "RUS";
+  // Taiwan has an ISO code but is not in the UN table.
+  QTest::newRow("TW") << "TW" << 158 << "";
+  QTest::newRow("419") << "419" << 419 << "";
+}
+
+void
+RegionTests::registryRegions()
+{
+  QFETCH(QString, subtag);
+  QFETCH(int, m49);
+  QFETCH(QString, alpha3);
+
+  QCOMPARE(m_languages.m49ForRegion(subtag), m49);
+  QCOMPARE(m_languages.alpha3ForRegion(subtag), alpha3);
+  QCOMPARE(m_languages.regionForM49(m49), subtag);
+}
+
+void
+RegionTests::alpha2Codes_data()
+{
+  QTest::addColumn<QString>("alpha2");
+  QTest::addColumn<int>("m49");
+
+  QTest::newRow("MD") << "MD" << 498;
+  QTest::newRow("KP") << "KP" << 408;
+  QTest::newRow("TZ") << "TZ" << 834;
+  QTest::newRow("CD") << "CD" << 180;
+  QTest::newRow("PS") << "PS" << 275;
+  QTest::newRow("VA") << "VA" << 336;
+  QTest::newRow("MO") << "MO" << 446;
+  QTest::newRow("TR") << "TR" << 792;
+  QTest::newRow("lower case") << "tr" << 792;
+  QTest::newRow("unassigned") << "AA" << -1;
+  QTest::newRow("too long") << "USA" << -1;
+}
+
+void
+RegionTests::alpha2Codes()
+{
+  QFETCH(QString, alpha2);
+  QFETCH(int, m49);
+
+  auto& codes = UNStatisticalCodes::instance();
+  QCOMPARE(codes.m49FromAlpha2Code(alpha2), m49);
+  if (m49 >= 0)
+    QVERIFY(codes.isM49Valid(m49));
+}
+
+QTEST_GUILESS_MAIN(RegionTests)
+#include "regiontests.moc"
@@ -0,0 +1,345 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QThread>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "language/language_c.h"
+#include "language/languages.h"
+#include "language/unstatistical.h"
+
+/*
+  Runs reader threads that look up and validate tags as fast as they can
+  while the main thread publishes refreshed registries one after another.
+
+  Every publish alternates between the registry and the registry with one
+  extra language, qsa, the extra record being in the registries with an odd
+  Julian day file date. A reader that sees qsa in a snapshot with an even
+  file date, or misses it in one with an odd date, has seen a snapshot mixed
+  from two registries. The readers also check that the lookups every registry
+  shares keep their answers.
+
+  Reports the reader throughput, the latency of a reader pass outside and
+  during publishes, and any failed checks. Exits with 1 if a check failed.
+  Configure with SANITIZE_THREAD to run it under ThreadSanitizer.
+*/
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*
+  Latencies counted in quarter octave buckets of nanoseconds. The
+  percentiles are the upper bound of their bucket, which is within 19% of
+  the true value, and a reader only pays for an increment.
+*/
+class Histogram
+{
+public:
+  void add(std::int64_t ns)
+  {
+    auto bucket = ns > 1 ? int(std::log2(double(ns)) * 4) : 0;
+    m_buckets[std::min(bucket, BUCKETS - 1)]++;
+    m_count++;
+    m_max = std::max(m_max, ns);
+  }
+
+  void merge(const Histogram& other)
+  {
+    for (int i = 0; i < BUCKETS; i++)
+      m_buckets[i] += other.m_buckets[i];
+    m_count += other.m_count;
+    m_max = std::max(m_max, other.m_max);
+  }
+
+  std::uint64_t count() const { return m_count; }
+  std::int64_t max() const { return m_max; }
+
+  //! Returns the latency that the fraction of passes took no longer than.
+  double percentile(double fraction) const
+  {
+    auto target = std::uint64_t(std::ceil(fraction * m_count));
+    std::uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+      seen += m_buckets[i];
+      if (seen >= target && seen > 0)
+        return std::min(std::pow(2.0, (i + 1) / 4.0), double(m_max));
+    }
+    return double(m_max);
+  }
+
+private:
+  static constexpr int BUCKETS = 160;
+  std::array<std::uint64_t, BUCKETS> m_buckets{};
+  std::uint64_t m_count = 0;
+  std::int64_t m_max = 0;
+};
+
+//! What one reader thread saw.
+struct Reader
+{
+  std::uint64_t passes = 0;
+  std::uint64_t failures = 0;
+  QString firstFailure;
+  Histogram quiet;
+  Histogram publishing;
+};
+
+const QByteArray EXTRA_RECORD = "%%\n"
+                                "Type: language\n"
+                                "Subtag: qsa\n"
+                                "Description: Stress test language\n"
+                                "Added: 2023-08-02\n";
+
+void
+runReader(Reader& reader,
+          const std::atomic<bool>& stop,
+          const std::atomic<bool>& publishing)
+{
+  // each thread has its own object, they all read the published snapshot.
+  BCP47Languages languages;
+  const QString extra = "qsa";
+  const QString language = "fr";
+  const QString region = "CA";
+  const QString tag = "fr-CA";
+  const QString badTag = "not a tag";
+  const QString mixedTag = "ZH-hant-tw";
+  const QString canonical = "zh-Hant-TW";
+  const char utf8Tag[] = "zh-Hant-TW";
+  auto check = [&reader](bool passed, const char* what) {
+    if (passed)
+      return;
+    if (reader.failures++ == 0)
+      reader.firstFailure = what;
+  };
+
+  while (!stop.load(std::memory_order_relaxed)) {
+    auto during = publishing.load(std::memory_order_relaxed);
+    auto start = Clock::now();
+
+    auto snapshot = BCP47Languages::snapshot();
+    auto odd = snapshot.fileDate().toJulianDay() % 2 != 0;
+    check(bool(snapshot.fromSubtag(BCP47Language::LANGUAGE, extra)) == odd,
+          "a snapshot mixed two registries");
+    check(bool(languages.languageFromSubtag(language)), "languageFromSubtag");
+    check(bool(languages.regionFromSubtag(region)), "regionFromSubtag");
+    check(languages.isPrimaryLanguage(language), "isPrimaryLanguage");
+    check(languages.isValidTag(tag), "isValidTag of a valid tag");
+    check(!languages.isValidTag(badTag), "isValidTag of a bad tag");
+    check(languages.canonicalTag(mixedTag) == canonical, "canonicalTag");
+    check(languages.m49ForRegion(region) == 124, "m49ForRegion");
+    check(!languages.displayName(tag, UNStatisticalCodes::English).isEmpty(),
+          "displayName");
+    auto handle = lang_snapshot_current();
+    check(lang_validate(handle, utf8Tag, sizeof(utf8Tag) - 1, nullptr) ==
+            LANG_OK,
+          "lang_validate");
+    lang_snapshot_release(handle);
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - start)
+                .count();
+    if (during || publishing.load(std::memory_order_relaxed))
+      reader.publishing.add(ns);
+    else
+      reader.quiet.add(ns);
+    reader.passes++;
+  }
+}
+
+void
+drainEvents()
+{
+  // the futures report through queued signals and free their watchers later.
+  QCoreApplication::processEvents();
+  QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+QString
+latencies(const Histogram& histogram, const QString& counted)
+{
+  if (histogram.count() == 0)
+    return QStringLiteral("no ") + counted;
+  return QString("p50 %1 us, p99 %2 us, p99.9 %3 us, max %4 us (%5 %6)")
+    .arg(histogram.percentile(0.5) / 1000, 0, 'f', 1)
+    .arg(histogram.percentile(0.99) / 1000, 0, 'f', 1)
+    .arg(histogram.percentile(0.999) / 1000, 0, 'f', 1)
+    .arg(histogram.max() / 1000.0, 0, 'f', 1)
+    .arg(histogram.count())
+    .arg(counted);
+}
+
+} // end of anonymous namespace
+
+int
+main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("language_stress");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription(
+    "Reads the language registry from many threads while it is refreshed.");
+  parser.addHelpOption();
+  QCommandLineOption readersOption(
+    { "r", "readers" },
+    "The reader threads.",
+    "count",
+    QString::number(std::max(2, QThread::idealThreadCount() - 1)));
+  QCommandLineOption secondsOption(
+    { "s", "seconds" }, "How long to run for.", "seconds", "10");
+  QCommandLineOption intervalOption(
+    "interval",
+    "The pause between publishes, none by default.",
+    "milliseconds",
+    "0");
+  QCommandLineOption registryOption(
+    "registry",
+    "The registry that is published.",
+    "file",
+    QStringLiteral(LANGUAGE_BENCHMARK_DATA "/language-subtag-registry.txt"));
+  parser.addOption(readersOption);
+  parser.addOption(secondsOption);
+  parser.addOption(intervalOption);
+  parser.addOption(registryOption);
+  parser.process(app);
+
+  QTextStream out(stdout);
+  QTextStream err(stderr);
+  bool readersOk, secondsOk, intervalOk;
+  auto readerCount = parser.value(readersOption).toInt(&readersOk);
+  auto seconds = parser.value(secondsOption).toDouble(&secondsOk);
+  auto interval = parser.value(intervalOption).toInt(&intervalOk);
+  if (!readersOk || readerCount < 1 || !secondsOk || seconds <= 0 ||
+      !intervalOk || interval < 0) {
+    err << "The reader count, run time or interval is not valid.\n";
+    return 2;
+  }
+
+  QFile registryFile(parser.value(registryOption));
+  if (!registryFile.open(QIODevice::ReadOnly)) {
+    err << registryFile.fileName() << ": " << registryFile.errorString()
+        << "\n";
+    return 2;
+  }
+  auto registry = registryFile.readAll();
+  if (!registry.endsWith('\n'))
+    registry.append('\n');
+  QTemporaryDir dir;
+  if (!dir.isValid()) {
+    err << "A temporary directory could not be made.\n";
+    return 2;
+  }
+
+  // every publish needs a newer file date than the last.
+  auto refreshFile = dir.filePath(QStringLiteral("registry.txt"));
+  auto fileDate = QDate(2000, 1, 1);
+  auto writeRegistry = [&registry, &refreshFile, &fileDate]() {
+    fileDate = fileDate.addDays(1);
+    auto data = registry;
+    data.replace(0,
+                 data.indexOf('\n'),
+                 "File-Date: " + fileDate.toString(Qt::ISODate).toLatin1());
+    if (fileDate.toJulianDay() % 2 != 0)
+      data.append(EXTRA_RECORD);
+    QFile file(refreshFile);
+    return file.open(QIODevice::WriteOnly | QIODevice::Truncate) &&
+           file.write(data) == data.size();
+  };
+
+  BCP47Languages::setRegistryDownloader(
+    [](const QString& url, QString& errorStr) {
+      QFile file(url);
+      if (!file.open(QIODevice::ReadOnly)) {
+        errorStr = file.errorString();
+        return QByteArray();
+      }
+      return file.readAll();
+    });
+  BCP47Languages languages;
+  languages.setRegistry(refreshFile);
+  if (!writeRegistry() ||
+      languages.refresh().result().fileDate() != fileDate) {
+    err << "The registry could not be loaded.\n";
+    return 2;
+  }
+  drainEvents();
+
+  std::atomic<bool> stop{ false };
+  std::atomic<bool> publishing{ false };
+  std::vector<Reader> readers(readerCount);
+  std::vector<std::thread> threads;
+  for (auto& reader : readers)
+    threads.emplace_back([&reader, &stop, &publishing]() {
+      runReader(reader, stop, publishing);
+    });
+
+  int publishes = 0;
+  int publishFailures = 0;
+  Histogram publishTimes;
+  auto start = Clock::now();
+  auto end = start + std::chrono::duration_cast<Clock::duration>(
+                       std::chrono::duration<double>(seconds));
+  while (Clock::now() < end) {
+    if (!writeRegistry()) {
+      err << "The registry could not be written.\n";
+      publishFailures++;
+      break;
+    }
+    auto publishStart = Clock::now();
+    publishing.store(true, std::memory_order_relaxed);
+    auto published = languages.refresh().result();
+    publishing.store(false, std::memory_order_relaxed);
+    publishTimes.add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       Clock::now() - publishStart)
+                       .count());
+    drainEvents();
+    if (published.fileDate() == fileDate)
+      publishes++;
+    else
+      publishFailures++;
+    if (interval > 0)
+      QThread::msleep(interval);
+  }
+  stop.store(true, std::memory_order_relaxed);
+  for (auto& thread : threads)
+    thread.join();
+  auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+  Histogram quiet, during;
+  std::uint64_t passes = 0;
+  std::uint64_t failures = 0;
+  for (auto& reader : readers) {
+    quiet.merge(reader.quiet);
+    during.merge(reader.publishing);
+    passes += reader.passes;
+    failures += reader.failures;
+  }
+
+  out << readerCount << " readers for " << QString::number(elapsed, 'f', 1)
+      << " s, " << publishes << " publishes, " << publishFailures
+      << " failed publishes\n";
+  out << "publish: " << latencies(publishTimes, "publishes") << "\n";
+  out << "reader throughput: " << QString::number(passes / elapsed, 'f', 0)
+      << " passes/s, "
+      << QString::number(passes / elapsed / readerCount, 'f', 0)
+      << " passes/s per reader\n";
+  out << "reader latency, quiet: " << latencies(quiet, "passes") << "\n";
+  out << "reader latency, during publishes: " << latencies(during, "passes")
+      << "\n";
+  out << "failed checks: " << failures << "\n";
+  for (int i = 0; i < readerCount; i++) {
+    if (readers[i].failures > 0)
+      out << "  reader " << i << ": " << readers[i].failures
+          << " failures, first " << readers[i].firstFailure << "\n";
+  }
+  return failures == 0 && publishFailures == 0 ? 0 : 1;
+}
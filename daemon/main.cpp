@@ -0,0 +1,58 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QTextStream>
+
+#include "language/languages.h"
+#include "language/registryservice.h"
+
+/*
+  Holds one copy of the language registry and answers queries from the
+  BCP47RegistryClient objects of every process of the same user on the host.
+ */
+int
+main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("bcp47-registryd");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Serves the BCP47 language registry.");
+  parser.addHelpOption();
+  QCommandLineOption fileOption(
+    { "f", "file" }, "The local YAML registry file.", "file");
+  QCommandLineOption nameOption({ "n", "name" },
+                                "The socket name.",
+                                "name",
+                                BCP47RegistryServer::defaultName());
+  parser.addOption(fileOption);
+  parser.addOption(nameOption);
+  parser.process(app);
+
+  QTextStream err(stderr);
+  if (!parser.isSet(fileOption)) {
+    err << "A registry file must be given.\n";
+    return 1;
+  }
+
+  BCP47Languages languages;
+  BCP47RegistryServer server(&languages);
+  QObject::connect(&languages,
+                   &BCP47Languages::error,
+                   [&err](const QString& errorStr) {
+                     err << errorStr << "\n";
+                     err.flush();
+                   });
+  QObject::connect(&server,
+                   &BCP47RegistryServer::error,
+                   [&err](const QString& errorStr) {
+                     err << errorStr << "\n";
+                     err.flush();
+                   });
+
+  // the file is read before this returns, the registry is refreshed later.
+  languages.readFromLocalFile(parser.value(fileOption));
+  if (!server.listen(parser.value(nameOption)))
+    return 1;
+
+  return app.exec();
+}
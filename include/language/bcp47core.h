@@ -0,0 +1,550 @@
+#ifndef BCP47CORE_H
+#define BCP47CORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+#include "language/registryimage.h"
+
+/*!
+  \namespace BCP47Core bcp47core.h
+  \brief Language tag validation, classification and canonicalisation
+  without Qt.
+
+  Everything here is header only C++17 and works on UTF-8 std::string_view
+  values against a registry image, see BCP47Snapshot::image(). The image can
+  be embedded in the program, read from a mapped file or shared memory, see
+  BCP47SharedRegistry, or taken from a BCP47Snapshot. Nothing allocates
+  memory, results are written into buffers supplied by the caller.
+
+  A tag is valid if it is well formed, as described in RFC 5646, and every
+  language, extended language, script, region and variant subtag is in the
+  registry or in one of the private use ranges. Grandfathered and redundant
+  tags are matched as a whole. Subtag prefixes are not checked. Tags are
+  case insensitive.
+
+  BCP47Languages uses this for its tag checks, so the Qt API and this give
+  the same answers.
+ */
+namespace BCP47Core {
+
+//! \enum Type
+//!
+//! The subtag types. The registry types have the same values as
+//! BCP47Language::Type.
+enum Type : uint8_t
+{
+  BadTag = 0,
+  Language = 1,
+  Extlang = 2,
+  Script = 3,
+  Region = 4,
+  Variant = 5,
+  Grandfathered = 6,
+  Redundant = 7,
+  Singleton = 8,  //!< An extension singleton.
+  Extension = 9,  //!< An extension subtag.
+  PrivateUse = 10 //!< The x singleton and the private use subtags.
+};
+
+//! \enum Error
+//!
+//! The reason a tag is not valid.
+enum Error : uint8_t
+{
+  NoError,
+  EmptyTag,           //!< The tag, or one of its subtags, is empty.
+  BadSyntax,          //!< A subtag is not allowed where it is.
+  UnknownSubtag,      //!< A subtag is well formed but not in the registry.
+  DuplicateVariant,   //!< A variant appears twice.
+  DuplicateSingleton, //!< An extension singleton appears twice.
+};
+
+//! A subtag found by Registry::classify().
+struct Subtag
+{
+  uint32_t start;  //!< The offset of the subtag in the tag.
+  uint32_t length; //!< The length of the subtag.
+  Type type;       //!< The type of the subtag.
+};
+
+//! The result of Registry::validate() or Registry::classify().
+struct Result
+{
+  Error error = NoError;
+  //! The index of the subtag that made the tag invalid.
+  std::size_t errorSubtag = 0;
+  //! The number of subtags, which may be more than were written.
+  std::size_t count = 0;
+
+  bool isValid() const { return error == NoError; }
+};
+
+/// \cond DO_NOT_DOCUMENT
+namespace Detail {
+
+inline bool
+isAlpha(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline bool
+isDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline char
+toLower(char c)
+{
+  return c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c;
+}
+
+inline char
+toUpper(char c)
+{
+  return c >= 'a' && c <= 'z' ? char(c - 'a' + 'A') : c;
+}
+
+inline bool
+all(std::string_view value, bool (*test)(char))
+{
+  for (auto c : value)
+    if (!test(c))
+      return false;
+  return true;
+}
+
+inline bool
+isAlnum(char c)
+{
+  return isAlpha(c) || isDigit(c);
+}
+
+inline bool
+equalsNoCase(std::string_view a, std::string_view b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (std::size_t i = 0; i < a.size(); i++)
+    if (toLower(a[i]) != toLower(b[i]))
+      return false;
+  return true;
+}
+
+//! Returns true if the subtag lies in the range, ignoring case.
+inline bool
+inRange(std::string_view subtag, std::string_view first, std::string_view last)
+{
+  if (subtag.size() != first.size())
+    return false;
+  auto compare = [subtag](std::string_view bound) {
+    for (std::size_t i = 0; i < subtag.size(); i++) {
+      auto a = toLower(subtag[i]), b = toLower(bound[i]);
+      if (a != b)
+        return a < b ? -1 : 1;
+    }
+    return 0;
+  };
+  return compare(first) >= 0 && compare(last) <= 0;
+}
+
+//! Appends to a caller supplied buffer, counting what does not fit.
+struct Writer
+{
+  char* out;
+  std::size_t capacity;
+  std::size_t length = 0;
+
+  void put(char c)
+  {
+    if (length < capacity)
+      out[length] = c;
+    length++;
+  }
+
+  void put(std::string_view value)
+  {
+    for (auto c : value)
+      put(c);
+  }
+};
+
+//! Splits a tag at its hyphens.
+struct Splitter
+{
+  std::string_view tag;
+  std::size_t position = 0;
+  bool done = false;
+
+  bool next(std::string_view& subtag, std::size_t& start)
+  {
+    if (done)
+      return false;
+    auto end = tag.find('-', position);
+    if (end == std::string_view::npos) {
+      end = tag.size();
+      done = true;
+    }
+    start = position;
+    subtag = tag.substr(position, end - position);
+    position = end + 1;
+    return true;
+  }
+};
+
+} // end of namespace Detail
+/// \endcond DO_NOT_DOCUMENT
+
+/*!
+  \class Registry bcp47core.h
+  \brief Answers tag queries from a registry image.
+
+  A Registry is a view, the image must outlive it. It is cheap to copy and
+  may be used from any number of threads at once.
+ */
+class Registry
+{
+public:
+  //! The longest subtag, other than a whole grandfathered or redundant tag.
+  static constexpr std::size_t MAX_SUBTAG = 8;
+  //! The longest grandfathered or redundant tag.
+  static constexpr std::size_t MAX_WHOLE_TAG = 16;
+
+  //! Constructs an empty registry, which knows no subtags.
+  Registry() = default;
+  //! Constructs a registry over the image.
+  explicit Registry(const RegistryImage::View& view)
+    : m_view(view)
+  {}
+  //! Constructs a registry over the image of size bytes at data.
+  Registry(const void* data, std::size_t size)
+    : m_view(data, size)
+  {}
+
+  //! Returns true if the image is valid.
+  bool isValid() const { return m_view.isValid(); }
+  //! Returns the image.
+  const RegistryImage::View& view() const { return m_view; }
+
+  //! \brief Returns true if the registry has the subtag, or whole tag, of
+  //! type.
+  //!
+  //! The subtag must be in its canonical case, see lookup().
+  bool contains(Type type, std::string_view subtag) const
+  {
+    return m_view.find(type, subtag) != nullptr;
+  }
+
+  //! \brief Returns the registry record of type for the subtag, ignoring
+  //! case, or nullptr if there is none.
+  const RegistryImage::Record* lookup(Type type, std::string_view subtag) const
+  {
+    char buffer[MAX_WHOLE_TAG];
+    if (subtag.empty() || subtag.size() > sizeof(buffer))
+      return nullptr;
+    if (type == Grandfathered || type == Redundant) {
+      Detail::Writer writer{ buffer, sizeof(buffer) };
+      caseTag(subtag, writer);
+      return m_view.find(type, std::string_view(buffer, writer.length));
+    }
+    if (subtag.size() > MAX_SUBTAG)
+      return nullptr;
+    for (std::size_t i = 0; i < subtag.size(); i++)
+      buffer[i] = caseFor(type, subtag[i], i);
+    return m_view.find(type, std::string_view(buffer, subtag.size()));
+  }
+
+  //! Returns true if the tag is valid, see validate().
+  bool isValid(std::string_view tag) const
+  {
+    return validate(tag).isValid();
+  }
+
+  //! Validates the tag.
+  Result validate(std::string_view tag) const
+  {
+    return classify(tag, nullptr, 0);
+  }
+
+  /*!
+    \brief Validates the tag and writes the type of each subtag into
+    subtags, which has room for capacity values.
+
+    Result::count is the number of subtags in the tag, if it is more than
+    capacity only the first capacity are written. Classification stops at
+    the first error. A grandfathered or redundant tag is a single subtag.
+   */
+  Result classify(std::string_view tag,
+                  Subtag* subtags,
+                  std::size_t capacity) const
+  {
+    Result result;
+    auto report = [&](std::size_t start, std::size_t length, Type type) {
+      if (subtags && result.count < capacity)
+        subtags[result.count] =
+          Subtag{ uint32_t(start), uint32_t(length), type };
+      result.count++;
+    };
+    auto fail = [&result](Error error) {
+      result.error = error;
+      result.errorSubtag = result.count;
+      return result;
+    };
+
+    if (tag.empty())
+      return fail(EmptyTag);
+    for (auto type : { Grandfathered, Redundant }) {
+      if (lookup(type, tag)) {
+        report(0, tag.size(), type);
+        return result;
+      }
+    }
+
+    // the position that the next subtag may take.
+    enum State
+    {
+      AtLanguage,
+      AtExtlang,
+      AtScript,
+      AtRegion,
+      AtVariant,
+      AtExtension,
+      AtPrivateUse,
+    };
+    auto state = AtLanguage;
+    auto extlangs = 0;
+    auto extensionSubtags = 0;
+    uint64_t singletons = 0;
+    std::string_view variants[8];
+    std::size_t variantCount = 0;
+
+    Detail::Splitter splitter{ tag };
+    std::string_view subtag;
+    std::size_t start;
+    while (splitter.next(subtag, start)) {
+      auto length = subtag.size();
+      if (length == 0)
+        return fail(EmptyTag);
+      if (length > MAX_SUBTAG || !Detail::all(subtag, Detail::isAlnum))
+        return fail(BadSyntax);
+      auto alpha = Detail::all(subtag, Detail::isAlpha);
+      auto digit = Detail::all(subtag, Detail::isDigit);
+
+      if (state == AtPrivateUse) {
+        report(start, length, PrivateUse);
+        continue;
+      }
+
+      if (length == 1) {
+        auto singleton = Detail::toLower(subtag[0]);
+        if (singleton == 'x') {
+          // an x with nothing after it is not allowed.
+          if (splitter.done)
+            return fail(BadSyntax);
+          state = AtPrivateUse;
+          report(start, length, PrivateUse);
+          continue;
+        }
+        if (state == AtLanguage ||
+            (state == AtExtension && extensionSubtags == 0))
+          return fail(BadSyntax);
+        auto bit = uint64_t(1) << (Detail::isDigit(singleton)
+                                     ? singleton - '0'
+                                     : singleton - 'a' + 10);
+        if (singletons & bit)
+          return fail(DuplicateSingleton);
+        singletons |= bit;
+        state = AtExtension;
+        extensionSubtags = 0;
+        report(start, length, Singleton);
+        continue;
+      }
+
+      if (state == AtExtension) {
+        extensionSubtags++;
+        report(start, length, Extension);
+        continue;
+      }
+
+      if (state == AtLanguage) {
+        if (!alpha || length == 4)
+          return fail(BadSyntax);
+        if (!Detail::inRange(subtag, "qaa", "qtz") && !lookup(Language, subtag))
+          return fail(UnknownSubtag);
+        state = length <= 3 ? AtExtlang : AtScript;
+        report(start, length, Language);
+      } else if (state == AtExtlang && extlangs < 3 && length == 3 && alpha) {
+        if (!lookup(Extlang, subtag))
+          return fail(UnknownSubtag);
+        extlangs++;
+        report(start, length, Extlang);
+      } else if (state <= AtScript && length == 4 && alpha) {
+        if (!Detail::inRange(subtag, "qaaa", "qabx") && !lookup(Script, subtag))
+          return fail(UnknownSubtag);
+        state = AtRegion;
+        report(start, length, Script);
+      } else if (state <= AtRegion &&
+                 ((length == 2 && alpha) || (length == 3 && digit))) {
+        if (!isPrivateRegion(subtag) && !lookup(Region, subtag))
+          return fail(UnknownSubtag);
+        state = AtVariant;
+        report(start, length, Region);
+      } else if (length >= 5 ||
+                 (length == 4 && Detail::isDigit(subtag[0]))) {
+        if (!lookup(Variant, subtag))
+          return fail(UnknownSubtag);
+        for (std::size_t i = 0; i < variantCount; i++)
+          if (Detail::equalsNoCase(variants[i], subtag))
+            return fail(DuplicateVariant);
+        if (variantCount < sizeof(variants) / sizeof(variants[0]))
+          variants[variantCount++] = subtag;
+        state = AtVariant;
+        report(start, length, Variant);
+      } else {
+        return fail(BadSyntax);
+      }
+    }
+
+    // an extension singleton needs at least one subtag.
+    if (state == AtExtension && extensionSubtags == 0)
+      return fail(BadSyntax);
+    return result;
+  }
+
+  /*!
+    \brief Writes the canonical form of the tag into out, which has room for
+    capacity characters, and returns its length.
+
+    If the length is more than capacity only the first capacity characters
+    are written, call again with a larger buffer. No terminating null is
+    written.
+
+    Subtags are given their canonical case. Grandfathered and redundant tags,
+    and deprecated subtags, that have a preferred value are replaced by it,
+    as is a language and extended language pair. Extensions and private use
+    subtags are only lower cased. The tag is not otherwise validated.
+   */
+  std::size_t canonicalise(std::string_view tag,
+                           char* out,
+                           std::size_t capacity) const
+  {
+    Detail::Writer writer{ out, capacity };
+    for (auto type : { Grandfathered, Redundant }) {
+      auto whole = lookup(type, tag);
+      if (whole) {
+        auto preferred = m_view.string(whole->preferredValue);
+        if (preferred.empty())
+          caseTag(tag, writer);
+        else
+          writer.put(preferred);
+        return writer.length;
+      }
+    }
+
+    Detail::Splitter splitter{ tag };
+    std::string_view subtag;
+    std::size_t start;
+    auto extension = false;
+    auto first = true;
+    for (std::size_t i = 0; splitter.next(subtag, start); i++) {
+      if (!first)
+        writer.put('-');
+      first = false;
+
+      if (subtag.size() == 1)
+        extension = true;
+      if (extension) {
+        for (auto c : subtag)
+          writer.put(Detail::toLower(c));
+        continue;
+      }
+
+      auto type = typeAt(subtag, i);
+      auto record = lookup(type, subtag);
+      if (record) {
+        auto preferred = m_view.string(record->preferredValue);
+        if (type == Extlang && !preferred.empty()) {
+          // the extlang preferred value replaces the language as well.
+          writer.length = 0;
+          writer.put(preferred);
+          continue;
+        }
+        if ((record->flags & RegistryImage::Deprecated) && !preferred.empty()) {
+          writer.put(preferred);
+          continue;
+        }
+      }
+      for (std::size_t c = 0; c < subtag.size(); c++)
+        writer.put(caseFor(type, subtag[c], c));
+    }
+    return writer.length;
+  }
+
+private:
+  RegistryImage::View m_view;
+
+  //! The type a subtag of this form has at position i, before any extension.
+  static Type typeAt(std::string_view subtag, std::size_t i)
+  {
+    if (i == 0)
+      return Language;
+    if (i == 1 && subtag.size() == 3 && Detail::isAlpha(subtag[0]))
+      return Extlang;
+    if (subtag.size() == 4 && Detail::isAlpha(subtag[0]))
+      return Script;
+    if (subtag.size() == 2 ||
+        (subtag.size() == 3 && Detail::isDigit(subtag[0])))
+      return Region;
+    return Variant;
+  }
+
+  //! The canonical case of character i of a subtag of type.
+  static char caseFor(Type type, char c, std::size_t i)
+  {
+    switch (type) {
+      case Script:
+        return i == 0 ? Detail::toUpper(c) : Detail::toLower(c);
+      case Region:
+        return Detail::toUpper(c);
+      default:
+        return Detail::toLower(c);
+    }
+  }
+
+  //! Writes the tag with every subtag in its canonical case.
+  static void caseTag(std::string_view tag, Detail::Writer& writer)
+  {
+    Detail::Splitter splitter{ tag };
+    std::string_view subtag;
+    std::size_t start;
+    auto extension = false;
+    for (std::size_t i = 0; splitter.next(subtag, start); i++) {
+      if (i > 0)
+        writer.put('-');
+      auto type = i == 0 || extension || subtag.size() == 1
+                    ? Language
+                    : typeAt(subtag, i);
+      if (subtag.size() == 1)
+        extension = true;
+      for (std::size_t c = 0; c < subtag.size(); c++)
+        writer.put(caseFor(type, subtag[c], c));
+    }
+  }
+
+  //! Returns true for the private use regions, AA, QM to QZ, XA to XZ and ZZ.
+  static bool isPrivateRegion(std::string_view subtag)
+  {
+    return Detail::equalsNoCase(subtag, "aa") ||
+           Detail::equalsNoCase(subtag, "zz") ||
+           Detail::inRange(subtag, "qm", "qz") ||
+           Detail::inRange(subtag, "xa", "xz");
+  }
+};
+
+} // end of namespace BCP47Core
+
+#endif // BCP47CORE_H
@@ -0,0 +1,202 @@
+#ifndef LANGUAGE_C_H
+#define LANGUAGE_C_H
+
+/*!
+  \file language_c.h
+  \brief A stable C interface to the tag checks, for use through FFI.
+
+  The functions work directly on UTF-8 buffers owned by the caller, which do
+  not need to be null terminated, and write their results into structs
+  supplied by the caller. Nothing is allocated per call and no strings are
+  converted, so a call costs little more than the check itself, see
+  BCP47Core::Registry.
+
+  Every check takes a snapshot handle. lang_snapshot_current() holds the data
+  last published by BCP47Languages in this process, lang_snapshot_open()
+  uses an image supplied by the caller, for example a mapped file written
+  from BCP47Snapshot::image(). A handle may be used from any number of
+  threads at once and is freed with lang_snapshot_release().
+
+  The structs only ever grow at their end and the enum values never change.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(LANGUAGE_LIBRARY)
+#define LANG_API __declspec(dllexport)
+#else
+#define LANG_API __declspec(dllimport)
+#endif
+#else
+#define LANG_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /*! An opaque snapshot of the registry. */
+  typedef struct lang_snapshot lang_snapshot;
+
+  /*! The subtag types, the same values as BCP47Core::Type. */
+  enum lang_type
+  {
+    LANG_TYPE_BAD = 0,
+    LANG_TYPE_LANGUAGE = 1,
+    LANG_TYPE_EXTLANG = 2,
+    LANG_TYPE_SCRIPT = 3,
+    LANG_TYPE_REGION = 4,
+    LANG_TYPE_VARIANT = 5,
+    LANG_TYPE_GRANDFATHERED = 6,
+    LANG_TYPE_REDUNDANT = 7,
+    LANG_TYPE_SINGLETON = 8,
+    LANG_TYPE_EXTENSION = 9,
+    LANG_TYPE_PRIVATE_USE = 10
+  };
+
+  /*! The result codes, the same values as BCP47Core::Error. */
+  enum lang_error
+  {
+    LANG_OK = 0,
+    LANG_EMPTY_TAG = 1,
+    LANG_BAD_SYNTAX = 2,
+    LANG_UNKNOWN_SUBTAG = 3,
+    LANG_DUPLICATE_VARIANT = 4,
+    LANG_DUPLICATE_SINGLETON = 5,
+    /*! A handle or required pointer was null. */
+    LANG_INVALID_ARGUMENT = 100
+  };
+
+  /*! The record flags. */
+  enum lang_flag
+  {
+    LANG_FLAG_DEPRECATED = 0x1,
+    LANG_FLAG_MACROLANGUAGE = 0x2,
+    LANG_FLAG_COLLECTION = 0x4
+  };
+
+  /*! A UTF-8 string that is not null terminated. */
+  typedef struct lang_string
+  {
+    const char* data;
+    size_t length;
+  } lang_string;
+
+  /*! The result of a validation. */
+  typedef struct lang_result
+  {
+    int32_t error;         /*!< A lang_error value. */
+    uint32_t error_subtag; /*!< The index of the subtag that failed. */
+    uint32_t count;        /*!< The number of subtags. */
+  } lang_result;
+
+  /*! A subtag of a classified tag. */
+  typedef struct lang_subtag
+  {
+    uint32_t start;  /*!< The offset of the subtag in the tag. */
+    uint32_t length; /*!< The length of the subtag. */
+    uint32_t type;   /*!< A lang_type value. */
+  } lang_subtag;
+
+  /*!
+    A registry record. The strings point into the snapshot and stay valid
+    until the handle is released.
+   */
+  typedef struct lang_record
+  {
+    lang_string subtag;
+    lang_string tag;
+    lang_string description; /*!< The first description. */
+    lang_string preferred_value;
+    uint32_t description_count;
+    uint32_t flags; /*!< lang_flag values. */
+  } lang_record;
+
+  /*! Returns a handle to the data currently published by BCP47Languages. */
+  LANG_API lang_snapshot* lang_snapshot_current(void);
+
+  /*!
+    Returns a handle to the image of size bytes at data, or null if it is
+    not a valid image. The image is not copied and must outlive the handle.
+   */
+  LANG_API lang_snapshot* lang_snapshot_open(const void* data, size_t size);
+
+  /*! Frees the handle, which may be null. */
+  LANG_API void lang_snapshot_release(lang_snapshot* snapshot);
+
+  /*! Returns the registry file date as a Julian day, 0 if there is none. */
+  LANG_API uint32_t lang_snapshot_file_date(const lang_snapshot* snapshot);
+
+  /*! Validates the tag, returns a lang_error value. result may be null. */
+  LANG_API int32_t lang_validate(const lang_snapshot* snapshot,
+                                 const char* tag,
+                                 size_t length,
+                                 lang_result* result);
+
+  /*!
+    Validates each of count tags, writing a result for each into results,
+    which may be null. Returns the number of valid tags.
+   */
+  LANG_API size_t lang_validate_batch(const lang_snapshot* snapshot,
+                                      const lang_string* tags,
+                                      size_t count,
+                                      lang_result* results);
+
+  /*! The most subtags that lang_classify() writes. */
+#define LANG_MAX_SUBTAGS 64
+
+  /*!
+    Validates the tag and writes the first capacity of its subtags, up to
+    LANG_MAX_SUBTAGS, into subtags. result->count is the number of subtags in
+    the tag. Returns a lang_error value.
+   */
+  LANG_API int32_t lang_classify(const lang_snapshot* snapshot,
+                                 const char* tag,
+                                 size_t length,
+                                 lang_subtag* subtags,
+                                 size_t capacity,
+                                 lang_result* result);
+
+  /*!
+    Writes the canonical form of the tag into out, which has room for
+    capacity bytes, and returns its length. If that is more than capacity
+    call again with a larger buffer. No terminating null is written.
+   */
+  LANG_API size_t lang_canonicalize(const lang_snapshot* snapshot,
+                                    const char* tag,
+                                    size_t length,
+                                    char* out,
+                                    size_t capacity);
+
+  /*!
+    Canonicalises each of count tags into consecutive parts of out, which has
+    room for capacity bytes, and sets each of results to its part of out.
+    Returns the total length needed, if that is more than capacity the
+    results are not complete, call again with a larger buffer.
+   */
+  LANG_API size_t lang_canonicalize_batch(const lang_snapshot* snapshot,
+                                          const lang_string* tags,
+                                          size_t count,
+                                          char* out,
+                                          size_t capacity,
+                                          lang_string* results);
+
+  /*!
+    Looks up the subtag, or the whole tag for the grandfathered and redundant
+    types, ignoring case. Returns 1 and fills record if it is found,
+    otherwise returns 0.
+   */
+  LANG_API int lang_lookup(const lang_snapshot* snapshot,
+                           uint32_t type,
+                           const char* subtag,
+                           size_t length,
+                           lang_record* record);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LANGUAGE_C_H */
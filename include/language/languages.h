@@ -3,9 +3,11 @@
 
 #include <QByteArray>
 #include <QDate>
-#include <QDialog>
 #include <QDir>
 #include <QFile>
+#include <QFuture>
+#include <QHash>
+#include <QLocale>
 #include <QObject>
 #include <QString>
 #include <QStringLiteral>
@@ -14,9 +16,15 @@
 
 #include <QtDebug>
 
+#include <functional>
+
 #include "language_global.h"
+#include "language/bcp47core.h"
 #include "language/unstatistical.h"
 
+class QFileSystemWatcher;
+class QTimer;
+
 /*!
   \class BCP47Language languages.h
   \brief A class that specifies information about a single language tag,
@@ -291,6 +299,90 @@ private:
 Q_DECLARE_OPERATORS_FOR_FLAGS(LanguageParser::Errors)
 /// \endcond DO_NOT_DOCUMENT
 
+/*!
+  \class BCP47Snapshot languages.h
+  \brief An immutable copy of the parsed registry and all of its indexes.
+
+  BCP47Languages builds a new snapshot every time the registry is loaded or
+  refreshed and then publishes it in a single atomic step, so a reader always
+  sees one complete version of the data. A snapshot is never modified after it
+  is built and is cheap to copy, so it can be handed to other threads freely.
+
+  An empty snapshot is returned before any data has been loaded.
+ */
+class LANGUAGE_SHARED_EXPORT BCP47Snapshot
+{
+public:
+  //! Constructs an empty snapshot.
+  BCP47Snapshot();
+
+  //! Returns true if the snapshot contains no data.
+  bool isEmpty() const;
+
+  //! Returns the file date of the registry the snapshot was built from.
+  QDate fileDate() const;
+
+  //! Returns the entire map of Description to BCP47Language objects.
+  QMultiMap<QString, QSharedPointer<BCP47Language>> dataset() const;
+
+  //! \brief Returns the BCP47Language of the supplied type for the subtag, or
+  //! a null pointer if there is none.
+  //!
+  //! GRANDFATHERED and REDUNDANT types are looked up by their whole tag.
+  QSharedPointer<BCP47Language> fromSubtag(BCP47Language::Type type,
+                                           const QString& subtag) const;
+
+  //! \brief Returns the BCP47Language of the supplied type for the
+  //! description, or a null pointer if there is none.
+  QSharedPointer<BCP47Language> fromDescription(
+    BCP47Language::Type type,
+    const QString& description) const;
+
+  //! Returns true if there is a BCP47Language of the type for the subtag.
+  bool contains(BCP47Language::Type type, const QString& subtag) const;
+
+  //! Returns the subtags, or tags, of the supplied type.
+  QVector<QString> subtags(BCP47Language::Type type) const;
+
+  //! Returns the descriptions of the supplied type.
+  QVector<QString> descriptions(BCP47Language::Type type) const;
+
+  //! \brief Returns the snapshot as a flat binary image.
+  //!
+  //! The image can be searched in place, from shared memory or a mapped file,
+  //! without building any maps, see BCP47SharedRegistry.
+  QByteArray image() const;
+
+  //! \brief Returns the Qt free tag checks over image().
+  //!
+  //! The returned registry is only valid for as long as this snapshot, or a
+  //! copy of it, exists.
+  BCP47Core::Registry core() const;
+
+  //! \brief Builds a snapshot, with all of its indexes, from a parsed
+  //! dataset.
+  //!
+  //! The snapshot is not published, BCP47Languages does that when it loads
+  //! or refreshes the registry.
+  static BCP47Snapshot build(
+    const QMultiMap<QString, QSharedPointer<BCP47Language>>& dataset,
+    const QDate& fileDate);
+
+private:
+  friend class BCP47Languages;
+  struct Data;
+  QSharedPointer<const Data> d;
+
+  static BCP47Snapshot update(
+    const BCP47Snapshot& previous,
+    const QMultiMap<QString, QSharedPointer<BCP47Language>>& dataset,
+    const QDate& fileDate);
+  static BCP47Snapshot seal(Data* data);
+  static void updateMaps(Data& data);
+  static void updateRegionJoin(Data& data);
+  QByteArray writeImage() const;
+};
+
 /*!
   \class BCP47Languages languages.h
   \brief A utility class to supply IAIN language tag names.
@@ -360,17 +452,88 @@ class LANGUAGE_SHARED_EXPORT BCP47Languages : public QObject
 public:
   //! Constructor for BCP47Languages
   BCP47Languages(QObject* parent = nullptr);
-  virtual ~BCP47Languages() = default;
+  virtual ~BCP47Languages();
 
   //! \brief Forces a rebuild of the language file fromn the registry.
+  //!
+  //! This is refresh() without the returned future.
   void rebuildFromRegistry();
 
   //! \brief Reads the data from the local YAML file.
   //!
-  //! This also reloads the registry in a background thread, checks if the file
-  //! has been updated and updates the stored data and YAML file accordingly.
+  //! The file is read before this returns and completed() is emitted. This
+  //! then reloads the registry in a background thread, checks if the file
+  //! has been updated and updates the stored data and YAML file accordingly,
+  //! see refresh().
   virtual void readFromLocalFile(const QString& filename);
 
+  //! \brief Loads the local YAML file in the background.
+  //!
+  //! The returned future finishes with the published snapshot once the file
+  //! has been read and indexed, so it can be waited on from any thread
+  //! without an event loop, or chained with continuations. completed() is
+  //! also emitted. The registry is not refreshed, call refresh() for that.
+  //!
+  //! If the file does not exist, or is no newer than the data already
+  //! published, the current snapshot is returned unchanged.
+  //!
+  //! Loads are shared by every BCP47Languages object in the process. While a
+  //! file is being loaded further calls wait on the same load, and a file
+  //! that has already been loaded is not read again until it changes.
+  QFuture<BCP47Snapshot> load(const QString& filename);
+
+  //! \brief Reloads the local YAML file whenever it changes on disk.
+  //!
+  //! The file last passed to readFromLocalFile() or load() is watched, as is
+  //! its directory so that a file replaced by a rename is still seen. A
+  //! change is loaded in the background with load(), only the records that
+  //! differ from the current snapshot are reindexed, and the result is
+  //! published atomically. languagesReset() is emitted if a newer registry
+  //! was published. Watching is off by default.
+  void setWatchLocalFile(bool watch);
+  //! Returns true if the local YAML file is being watched.
+  bool isWatchingLocalFile() const;
+
+  //! \brief Refreshes the data from the registry in the background.
+  //!
+  //! The registry is downloaded, parsed and indexed as stages on a bounded
+  //! thread pool shared by all BCP47Languages objects, so no threads are
+  //! created per refresh. The returned future finishes with the published
+  //! snapshot, which is unchanged if the registry is no newer than the current
+  //! data or could not be read. If the data changed languagesReset() is
+  //! emitted and the local file is saved, also on the pool.
+  //!
+  //! Refreshes are shared by every BCP47Languages object in the process.
+  //! While a refresh of the registry is running further calls, from this or
+  //! any other object, return the same future. Every object still emits its
+  //! own signals, but only the object that started the refresh saves the
+  //! local file.
+  //!
+  //! The download uses the installed RegistryDownloader. Language::Core has
+  //! none, so without Language::Network the current snapshot is returned.
+  QFuture<BCP47Snapshot> refresh();
+
+  /*!
+    \brief Downloads the registry at url, returning its contents.
+
+    On failure errorStr is set, or an empty array is returned. It is called on
+    a pool thread without an event loop.
+   */
+  using RegistryDownloader =
+    std::function<QByteArray(const QString& url, QString& errorStr)>;
+
+  //! \brief Installs the downloader used by refresh() in every
+  //! BCP47Languages object.
+  //!
+  //! Language::Network installs one based on FileDownloader, see
+  //! BCP47Network::install().
+  static void setRegistryDownloader(RegistryDownloader downloader);
+
+  //! \brief Returns the currently published snapshot.
+  //!
+  //! The snapshot is shared by every BCP47Languages object in the process.
+  static BCP47Snapshot snapshot();
+
   //! \brief Returns the set of description strings.
   //!
   //! This is the entire list of descriptions for ALL BCP47Language types.
@@ -516,6 +679,16 @@ public:
   //! reasons.
   QVector<QString> redundantTags() const;
 
+  //! \brief Returns the descriptions of the supplied type, sorted for the
+  //! locale.
+  //!
+  //! This is the sorted equivalent of languageDescriptions(),
+  //! regionDescriptions() and so on. Each list is sorted by collation sort
+  //! keys once per locale and cached until the data is next reloaded, so
+  //! later calls only return a shared copy.
+  QVector<QString> sortedDescriptions(BCP47Language::Type type,
+                                      const QLocale& locale = QLocale()) const;
+
   //! \brief Returns the tag for the supplied language name, with optional
   //! region name.
   //!
@@ -524,6 +697,53 @@ public:
   //! be returned.
   QString languageTag(const QString& languageName, const QString& regionName);
 
+  //! \brief Returns a human readable name for the tag, for example
+  //! "French (Canada)" for fr-CA.
+  //!
+  //! The primary language, or extended language, description is followed by
+  //! the script, region and variant descriptions in brackets. Registry
+  //! descriptions are only available in English, however regions that are
+  //! UN countries or areas use the UN name in the display language, so fr-CA
+  //! displayed in French gives "French (Canada)" and displayed in Russian
+  //! gives "French (Канада)". Grandfathered and redundant tags use their own
+  //! description. An empty string is returned if the primary language is not
+  //! valid.
+  //!
+  //! Composed names are kept in a bounded cache shared between threads, so
+  //! repeated calls for the same tag cost a single cache lookup.
+  QString displayName(const QString& tag,
+                      UNStatisticalCodes::Language displayLanguage =
+                        UNStatisticalCodes::English) const;
+  //! \brief Returns a human readable name for the tag from the snapshot.
+  //!
+  //! As displayName() but the name is always composed, the cache only holds
+  //! names from the published snapshot.
+  QString displayName(const BCP47Snapshot& snapshot,
+                      const QString& tag,
+                      UNStatisticalCodes::Language displayLanguage =
+                        UNStatisticalCodes::English) const;
+
+  //! \brief Returns the tag in its canonical form, for example "zh-Hant-TW"
+  //! for "ZH-hant-tw", or "jbo" for the grandfathered "art-lojban".
+  //!
+  //! Subtags are given their canonical case, language subtags in lower case,
+  //! scripts in title case and regions in upper case. Grandfathered and
+  //! redundant tags, and deprecated subtags, that have a preferred value are
+  //! replaced by it, as is a language and extended language pair. Extensions
+  //! and private use subtags are only lower cased. The tag is not otherwise
+  //! validated, see isValidTag().
+  QString canonicalTag(const QString& tag) const;
+  //! Returns the tag in its canonical form in the snapshot, see
+  //! canonicalTag().
+  QString canonicalTag(const BCP47Snapshot& snapshot,
+                       const QString& tag) const;
+
+  //! \brief Returns true if the tag is valid.
+  //!
+  //! The tag must be well formed and each of its subtags must be in the
+  //! registry, see BCP47Core::Registry::validate(). Case is ignored.
+  bool isValidTag(const QString& tag) const;
+
   //! \brief Return the tag value for the supplied extlang name .
   //!
   //! For example for the Gulf Arabic it would return **ar-afb** would be
@@ -565,6 +785,10 @@ public:
 
   //! tests the tag for correctness.
   QVector<QSharedPointer<BCP47Language::TagTestResult>> testTag(QString& tag);
+  //! tests the tag for correctness against the snapshot.
+  QVector<QSharedPointer<BCP47Language::TagTestResult>> testTag(
+    const BCP47Snapshot& snapshot,
+    QString& tag);
 
   //! Tests whether the subtag string is a valid primary language tag. Returns
   //! true if it is otherwise returns false.
@@ -582,6 +806,33 @@ public:
   //! true if it is otherwise returns false.
   bool isRegion(const QString& subtag);
 
+  //! \brief Tests whether the region subtag lies within the region, for
+  //! example whether 005 (South America) is within 419 (Latin America and the
+  //! Caribbean). Returns true if it is otherwise returns false.
+  //!
+  //! A region contains itself. Both subtags are resolved to their M49 codes,
+  //! see m49ForRegion(), and then through the UN M49 region hierarchy, so
+  //! 419 contains BR.
+  bool regionContains(const QString& region, const QString& subtag);
+
+  //! \brief Returns the UN M49 code for the region subtag, or -1 if it has
+  //! none.
+  //!
+  //! Numeric subtags such as 419 are their own M49 code. Alphabetic subtags
+  //! such as CA are ISO 3166-1 codes and are joined through their ISO numeric
+  //! code, see UNStatisticalCodes::m49FromAlpha2Code(), those withdrawn from
+  //! ISO 3166-1 through the UN country or area of the same name. The join is
+  //! made when the data is loaded, so this is a single hash lookup.
+  int m49ForRegion(const QString& subtag) const;
+
+  //! \brief Returns the UN alpha-3 code for the region subtag, for example
+  //! CAN for CA, or an empty string if it has none.
+  QString alpha3ForRegion(const QString& subtag) const;
+
+  //! \brief Returns the region subtag for the UN M49 code, for example CA for
+  //! 124 or 419 for 419, or an empty string if no region subtag uses it.
+  QString regionForM49(int m49) const;
+
   //! Tests whether the subtag string is a valid script tag. Returns
   //! true if it is otherwise returns false.
   bool isScript(const QString& subtag);
@@ -605,6 +856,8 @@ public:
   //! By default the data is saved to a YAML file. This method is virtual to
   //! allow users to create their own languages class that saves the data to a
   //! different file format.
+  //!
+  //! \note After a registry refresh this is called from a thread pool thread.
   virtual void saveToLocalFile(const QString& filename);
 
   //! Sets the registry name for the iain language registry.
@@ -637,8 +890,10 @@ public:
   BCP47Language::TagType checkScript(const QString& value);
   //! Checks whether the tag is a regional tag.
   //!
-  //! Returns one of three values:
+  //! Returns one of four values:
   //! - BCP47Language::REGIONAL_LANGUAGE if it is a primary language tag.
+  //! - BCP47Language::UN_STATISTICAL_REGION if it is a registered UN M49
+  //!   region such as 419.
   //! - BCP47Language::PRIVATE_REGION if it is a private use language tag.
   //! - BCP47Language::NO_REGION if it is NOT a primary language tag.
   BCP47Language::TagType checkRegion(const QString& value);
@@ -681,48 +936,37 @@ signals:
 
 private:
   QString m_languageFilename;
-  static QMultiMap<QString, QSharedPointer<BCP47Language>>
-    m_datasetByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_languageByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_languageBySubtag;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_extlangByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_extlangBySubtag;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_regionByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_regionBySubtag;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_scriptByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_scriptBySubtag;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_variantByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_variantBySubtag;
-  // some grandfathered descriptions are NOT unique.
-  static QMultiMap<QString, QSharedPointer<BCP47Language>>
-    m_grandfatheredByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_grandfatheredByTag;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_redundantByDescription;
-  static QMap<QString, QSharedPointer<BCP47Language>> m_redundantByTag;
-
-  QDate m_fileDate;
-  LanguageParser* worker;
   QString m_registryName;
-  UNStatisticalCodes* m_unStatistical;
+  const UNStatisticalCodes* m_unStatistical;
+  QFuture<BCP47Snapshot> m_refresh;
+  QFuture<void> m_persist;
+  QFileSystemWatcher* m_watcher = nullptr;
+  QTimer* m_reloadTimer = nullptr;
 
   const static QVector<QString> TAGTYPES;
+
+  BCP47Language::TagType checkPrimaryLanguage(const BCP47Snapshot& snapshot,
+                                              const QString& value) const;
+  BCP47Language::TagType checkExtendedlanguage(const BCP47Snapshot& snapshot,
+                                               const QString& value) const;
+  BCP47Language::TagType checkScript(const BCP47Snapshot& snapshot,
+                                     const QString& value) const;
+  BCP47Language::TagType checkRegion(const BCP47Snapshot& snapshot,
+                                     const QString& value) const;
   const static QString IAINREGISTRY;
 
-  void addLanguage(const QString& description,
-                   QSharedPointer<BCP47Language> language);
-  void loadYamlFile(QFile& file);
   //  void checkLocalFileForNewer(
   //    const QString& filename,
   //    QMultiMap<QString, QSharedPointer<BCP47Language>> map,
   //    QDate fileDate);
   void reloadData();
-  void parseData(const QByteArray& data);
   void errorReceived(const QString& errorStr);
   void parsingErrorsReceived(QMultiMap<int, LanguageParser::Errors> errors);
-  void iainFileParsed(QMultiMap<QString, QSharedPointer<BCP47Language>>,
-                      QDate,
-                      bool noErrors);
-  void updateMaps();
+  void watchLocalFile();
+  void reloadLocalFile();
+  static bool publish(const BCP47Snapshot& snapshot,
+                      bool replaceSameDate = false);
+  static QFuture<BCP47Snapshot> sharedLoad(const QString& filename);
 
   friend class LanguageParser;
   QVector<QSharedPointer<BCP47Language>> getUniqueLanguages();
@@ -0,0 +1,34 @@
+#ifndef LANGUAGE_NETWORK_H
+#define LANGUAGE_NETWORK_H
+
+#include <QByteArray>
+#include <QString>
+
+#include "language_global.h"
+
+/*!
+  \namespace BCP47Network network.h
+  \brief The network parts of the library, built as Language::Network.
+
+  Language::Core has no network access, BCP47Languages::refresh() only
+  downloads the registry once a downloader is installed. Linking
+  Language::Network installs one when the QCoreApplication is constructed.
+  Applications that construct BCP47Languages objects earlier, or link the
+  libraries statically, call install() themselves.
+ */
+namespace BCP47Network {
+
+//! \brief Downloads the registry at url with a FileDownloader.
+//!
+//! FileDownloader needs an event loop, so one is run until the download
+//! finishes. On failure errorStr is set.
+LANGUAGE_SHARED_EXPORT QByteArray
+download(const QString& url, QString& errorStr);
+
+//! Installs download() as the BCP47Languages registry downloader.
+LANGUAGE_SHARED_EXPORT void
+install();
+
+} // end of namespace BCP47Network
+
+#endif // LANGUAGE_NETWORK_H
@@ -0,0 +1,253 @@
+#ifndef REGISTRYIMAGE_H
+#define REGISTRYIMAGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+/// \cond DO_NOT_DOCUMENT
+/*!
+  \file registryimage.h
+  \brief A flat, position independent image of the registry indexes.
+
+  The image is a single block of memory that can be searched where it lies,
+  in shared memory or a mapped file, without building any maps. All values
+  are 32 bit, in host byte order and aligned to four bytes. Offsets are from
+  the start of the image.
+
+  - A Header, holding a Table for each BCP47Language::Type.
+  - Strings, each a length followed by the UTF-8 bytes. Offset 0 is the empty
+    string.
+  - String lists, each a count followed by the offsets of the strings. Offset
+    0 is the empty list.
+  - For each type a Record array sorted by key, the subtag or, for
+    GRANDFATHERED and REDUNDANT types, the whole tag, followed by a
+    DescriptionEntry array sorted by description.
+
+  Keys and descriptions are sorted by their UTF-8 bytes so that they can be
+  binary searched with std::string_view comparisons.
+ */
+namespace RegistryImage {
+
+const uint32_t MAGIC = 0x42435049; // "BCPI"
+const uint32_t VERSION = 1;
+//! The number of BCP47Language::Type values, BAD_TAG to REDUNDANT.
+const int TYPES = 8;
+
+//! The records and description index of one type.
+struct Table
+{
+  uint32_t records;
+  uint32_t count;
+  uint32_t descriptions;
+  uint32_t descriptionCount;
+};
+
+struct Header
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;
+  //! The registry file date as a Julian day, 0 if there is none.
+  uint32_t fileDate;
+  Table tables[TYPES];
+};
+
+enum RecordFlag : uint32_t
+{
+  Deprecated = 0x1,
+  Macrolanguage = 0x2,
+  Collection = 0x4,
+};
+
+//! A single BCP47Language, string and list values are offsets.
+struct Record
+{
+  uint32_t key;
+  uint32_t subtag;
+  uint32_t tag;
+  uint32_t descriptions;
+  uint32_t preferredValue;
+  uint32_t suppressScript;
+  uint32_t macrolanguage;
+  uint32_t comments;
+  uint32_t prefixes;
+  //! The date added as a Julian day, 0 if there is none.
+  uint32_t added;
+  uint32_t flags;
+};
+
+//! Links a description to the index of its record within the same type.
+struct DescriptionEntry
+{
+  uint32_t description;
+  uint32_t record;
+};
+
+/*!
+  \brief A read only view of an image.
+
+  The view does not own the memory, which must stay mapped for as long as
+  the view, and any string_view it returned, is used. Every offset is
+  checked against the image size so that a damaged image cannot cause reads
+  outside of it.
+ */
+class View
+{
+public:
+  View() = default;
+  View(const void* data, std::size_t size)
+    : m_data(static_cast<const char*>(data))
+    , m_size(size)
+  {
+    if (!m_data || m_size < sizeof(Header) ||
+        reinterpret_cast<std::uintptr_t>(m_data) % alignof(Header) != 0) {
+      reset();
+      return;
+    }
+    auto header = this->header();
+    if (header->magic != MAGIC || header->version != VERSION ||
+        header->size > m_size) {
+      reset();
+      return;
+    }
+    m_size = header->size;
+    for (auto& table : header->tables) {
+      if (!fits(table.records, table.count, sizeof(Record)) ||
+          !fits(table.descriptions,
+                table.descriptionCount,
+                sizeof(DescriptionEntry))) {
+        reset();
+        return;
+      }
+    }
+  }
+
+  bool isValid() const { return m_data != nullptr; }
+  const char* data() const { return m_data; }
+  std::size_t size() const { return m_size; }
+  uint32_t fileDate() const { return isValid() ? header()->fileDate : 0; }
+
+  //! Returns the string at offset, empty if the offset is not valid.
+  std::string_view string(uint32_t offset) const
+  {
+    uint32_t length;
+    if (offset == 0 || !read(offset, length) ||
+        !fits(offset + sizeof(uint32_t), length, 1))
+      return std::string_view();
+    return std::string_view(m_data + offset + sizeof(uint32_t), length);
+  }
+
+  //! Returns the number of strings in the list at offset.
+  uint32_t listSize(uint32_t offset) const
+  {
+    uint32_t count;
+    if (offset == 0 || !read(offset, count) ||
+        !fits(offset + sizeof(uint32_t), count, sizeof(uint32_t)))
+      return 0;
+    return count;
+  }
+
+  //! Returns string i of the list at offset.
+  std::string_view listAt(uint32_t offset, uint32_t i) const
+  {
+    if (i >= listSize(offset))
+      return std::string_view();
+    uint32_t value;
+    read(offset + sizeof(uint32_t) * (i + 1), value);
+    return string(value);
+  }
+
+  //! Returns the number of records of the type.
+  uint32_t count(int type) const { return table(type).count; }
+
+  //! Returns record i of the type, nullptr if there is none.
+  const Record* record(int type, uint32_t i) const
+  {
+    auto& table = this->table(type);
+    if (i >= table.count)
+      return nullptr;
+    return reinterpret_cast<const Record*>(m_data + table.records) + i;
+  }
+
+  //! Returns the record of the type with the key, nullptr if there is none.
+  const Record* find(int type, std::string_view key) const
+  {
+    auto& table = this->table(type);
+    if (table.count == 0)
+      return nullptr;
+    auto first = reinterpret_cast<const Record*>(m_data + table.records);
+    auto last = first + table.count;
+    auto it = std::lower_bound(
+      first, last, key, [this](const Record& record, std::string_view key) {
+        return string(record.key) < key;
+      });
+    return it != last && string(it->key) == key ? it : nullptr;
+  }
+
+  //! Returns the range of description entries of the type that match the
+  //! description, in the order of BCP47Snapshot::dataset().
+  std::pair<const DescriptionEntry*, const DescriptionEntry*>
+  findDescription(int type, std::string_view description) const
+  {
+    auto& table = this->table(type);
+    if (table.descriptionCount == 0)
+      return { nullptr, nullptr };
+    auto first =
+      reinterpret_cast<const DescriptionEntry*>(m_data + table.descriptions);
+    auto last = first + table.descriptionCount;
+    auto less = [this](const DescriptionEntry& entry, std::string_view text) {
+      return string(entry.description) < text;
+    };
+    auto greater = [this](std::string_view text,
+                          const DescriptionEntry& entry) {
+      return text < string(entry.description);
+    };
+    return { std::lower_bound(first, last, description, less),
+             std::upper_bound(first, last, description, greater) };
+  }
+
+private:
+  const char* m_data = nullptr;
+  std::size_t m_size = 0;
+
+  const Header* header() const
+  {
+    return reinterpret_cast<const Header*>(m_data);
+  }
+
+  const Table& table(int type) const
+  {
+    static const Table empty = {};
+    if (!isValid() || type < 0 || type >= TYPES)
+      return empty;
+    return header()->tables[type];
+  }
+
+  void reset()
+  {
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  bool fits(std::size_t offset, std::size_t count, std::size_t size) const
+  {
+    return offset <= m_size && count <= (m_size - offset) / size;
+  }
+
+  bool read(std::size_t offset, uint32_t& value) const
+  {
+    if (offset % sizeof(uint32_t) != 0 || !fits(offset, 1, sizeof(uint32_t)))
+      return false;
+    std::memcpy(&value, m_data + offset, sizeof(uint32_t));
+    return true;
+  }
+};
+
+} // end of namespace RegistryImage
+/// \endcond DO_NOT_DOCUMENT
+
+#endif // REGISTRYIMAGE_H
@@ -0,0 +1,170 @@
+#ifndef REGISTRYSERVICE_H
+#define REGISTRYSERVICE_H
+
+#include <QDate>
+#include <QObject>
+#include <QString>
+#include <QVector>
+
+#include "language_global.h"
+#include "language/languages.h"
+
+class QLocalServer;
+class QLocalSocket;
+
+/*!
+  \class BCP47RegistryServer registryservice.h
+  \brief Answers language tag queries from other processes over a local
+  socket.
+
+  On a host that runs many small processes each one would otherwise load the
+  whole registry and build its own indexes. Instead one process can hold the
+  data and serve the rest, which use a BCP47RegistryClient. A refresh in the
+  serving process is seen by every client.
+
+  The socket is a Unix domain socket, or a named pipe on Windows, see
+  QLocalServer. Only the user that started the server can connect to it.
+
+  Queries are answered on the thread that owns the server, in the order that
+  they arrive, from the BCP47Languages object that the server was created
+  with.
+ */
+class LANGUAGE_SHARED_EXPORT BCP47RegistryServer : public QObject
+{
+  Q_OBJECT
+public:
+  //! Constructs a server that answers queries from languages.
+  BCP47RegistryServer(BCP47Languages* languages, QObject* parent = nullptr);
+  ~BCP47RegistryServer();
+
+  //! \brief Starts listening for clients on the named socket.
+  //!
+  //! A socket left behind by a server that has died is removed first.
+  //! Returns true on success, otherwise emits error() and returns false.
+  bool listen(const QString& name = defaultName());
+  //! Stops listening and disconnects every client.
+  void close();
+  //! Returns true if the server is listening for clients.
+  bool isListening() const;
+
+  //! \brief Returns the default socket name.
+  //!
+  //! The name includes the user name so that several users on the same host
+  //! each have their own server.
+  static QString defaultName();
+
+signals:
+  //! \brief Emitted when the server cannot listen or a client misbehaves.
+  void error(const QString& errorStr);
+
+private:
+  BCP47Languages* m_languages;
+  QLocalServer* m_server;
+
+  void clientConnected();
+  void readRequests(QLocalSocket* socket);
+  bool answer(const QByteArray& request, QByteArray& reply);
+};
+
+/*!
+  \class BCP47RegistryClient registryservice.h
+  \brief Queries a BCP47RegistryServer in another process.
+
+  Queries are sent in batches, a whole batch costs a single round trip to the
+  server, see query(). The convenience methods each send a batch of one.
+
+  The client blocks while it waits for the server and does not need an event
+  loop, however a client must only be used by one thread at a time. If the
+  server cannot be reached the methods return empty results, isConnected()
+  returns false and errorString() describes the problem.
+ */
+class LANGUAGE_SHARED_EXPORT BCP47RegistryClient
+{
+public:
+  //! \enum Operation
+  //!
+  //! The queries that a server answers.
+  enum Operation
+  {
+    //! Tests the tag, see BCP47Languages::testTag(). Found is true if
+    //! no subtag is bad, flags are the combined BCP47Language::TagTypes
+    //! flags and values hold the subtags.
+    Validate = 1,
+    //! The value is the canonical tag, see BCP47Languages::canonicalTag().
+    Canonicalise,
+    //! Looks up the subtag of the query type. Values hold its descriptions,
+    //! the value is its preferred value and flags are 1 if it is deprecated.
+    Lookup,
+    //! Values hold the tags or subtags of every type whose description
+    //! matches the query value, see BCP47Languages::fromDescription().
+    Match,
+    //! The value is the display name of the tag, see
+    //! BCP47Languages::displayName().
+    DisplayName,
+  };
+
+  //! A single query within a batch.
+  struct Query
+  {
+    Operation operation; //!< What is asked for.
+    QString value;       //!< The tag, subtag or description.
+    //! The subtag type, only used by Lookup.
+    BCP47Language::Type type = BCP47Language::BAD_TAG;
+  };
+
+  //! The answer to a single query.
+  struct Answer
+  {
+    bool found = false;      //!< True if the query could be answered.
+    quint32 flags = 0;       //!< Flags, depending on the operation.
+    QString value;           //!< A single value result.
+    QVector<QString> values; //!< A multiple value result.
+  };
+
+  //! Constructs a client of the server listening on name.
+  explicit BCP47RegistryClient(
+    const QString& name = BCP47RegistryServer::defaultName());
+  ~BCP47RegistryClient();
+
+  //! \brief Connects to the server, waiting for at most msecs milliseconds.
+  //!
+  //! The other methods connect on demand, so this is only needed to check
+  //! that a server is running.
+  bool connectToServer(int msecs = 1000);
+  //! Returns true if the client is connected to a server.
+  bool isConnected() const;
+  //! Returns a description of the last error.
+  QString errorString() const;
+
+  //! \brief Sends the batch to the server and returns one answer for each
+  //! query, in the same order.
+  //!
+  //! Waits for at most msecs milliseconds for the answers. Returns an empty
+  //! vector if the server could not be reached or did not answer in time.
+  QVector<Answer> query(const QVector<Query>& batch, int msecs = 5000);
+
+  //! Returns the registry file date of the data that answered the last batch.
+  QDate fileDate() const;
+
+  //! Returns true if the tag is valid.
+  bool isValid(const QString& tag);
+  //! Returns the canonical form of the tag.
+  QString canonicalTag(const QString& tag);
+  //! Returns the descriptions of the subtag of type.
+  QVector<QString> descriptions(BCP47Language::Type type,
+                                const QString& subtag);
+  //! Returns the tags or subtags that have the description.
+  QVector<QString> match(const QString& description);
+  //! Returns the English display name of the tag.
+  QString displayName(const QString& tag);
+
+private:
+  QString m_name;
+  QLocalSocket* m_socket;
+  QString m_errorString;
+  QDate m_fileDate;
+
+  Answer single(const Query& query);
+};
+
+#endif // REGISTRYSERVICE_H
@@ -0,0 +1,86 @@
+#ifndef SHAREDREGISTRY_H
+#define SHAREDREGISTRY_H
+
+#include <QDate>
+#include <QScopedPointer>
+#include <QSharedPointer>
+#include <QString>
+
+#include "language_global.h"
+#include "language/languages.h"
+
+class QSharedMemory;
+
+/*!
+  \class BCP47SharedRegistry sharedregistry.h
+  \brief Shares a registry snapshot between the processes of a host through
+  shared memory.
+
+  One process publishes a snapshot with publish(), any number of processes
+  then search the same read only pages in place, see BCP47Snapshot::image().
+  Memory use and load time do not grow with the number of processes and,
+  unlike BCP47RegistryClient, a lookup never leaves the process.
+
+  Every publish() creates a new generation of the image. A small control
+  segment holds the current generation number, which a reader checks before
+  each lookup, switching to the new image if it has changed. The publisher
+  keeps the current image alive, an older image is freed by the system once
+  the last reader has moved on from it.
+
+  Each object may only be used by one thread at a time.
+ */
+class LANGUAGE_SHARED_EXPORT BCP47SharedRegistry
+{
+public:
+  //! Constructs a registry that shares its images under key.
+  explicit BCP47SharedRegistry(const QString& key = defaultKey());
+  ~BCP47SharedRegistry();
+
+  //! \brief Returns the default key.
+  //!
+  //! The key includes the user name so that several users on the same host
+  //! each have their own images.
+  static QString defaultKey();
+
+  //! \brief Publishes the snapshot as the next generation.
+  //!
+  //! Returns true on success, otherwise returns false and errorString()
+  //! describes the problem. The image stays available to readers until this
+  //! object publishes another or is destroyed.
+  bool publish(const BCP47Snapshot& snapshot);
+
+  //! \brief Returns true if an image has been published.
+  //!
+  //! This also switches to the latest generation.
+  bool isAvailable();
+  //! Returns the generation of the image in use, 0 if there is none.
+  quint32 generation() const;
+  //! Returns a description of the last error.
+  QString errorString() const;
+
+  //! Returns the file date of the registry the image was built from.
+  QDate fileDate();
+
+  //! \brief Returns a copy of the BCP47Language of the supplied type for the
+  //! subtag, or a null pointer if there is none.
+  //!
+  //! GRANDFATHERED and REDUNDANT types are looked up by their whole tag.
+  QSharedPointer<BCP47Language> fromSubtag(BCP47Language::Type type,
+                                           const QString& subtag);
+  //! \brief Returns a copy of the BCP47Language of the supplied type for the
+  //! description, or a null pointer if there is none.
+  QSharedPointer<BCP47Language> fromDescription(
+    BCP47Language::Type type,
+    const QString& description);
+  //! \brief Returns true if there is a BCP47Language of the type for the
+  //! subtag.
+  //!
+  //! The subtag must match the case of the registry. This does not allocate.
+  bool contains(BCP47Language::Type type, const QString& subtag);
+
+private:
+  struct Private;
+  QScopedPointer<Private> d;
+};
+
+#endif // SHAREDREGISTRY_H
@@ -1,9 +1,16 @@
 #ifndef UNSTATISTICAL_H
 #define UNSTATISTICAL_H
 
-#include <QMap>
+#include <QLocale>
 #include <QString>
 #include <QStringLiteral>
+#include <QVector>
+
+/// \cond DO_NOT_DOCUMENT
+namespace UNStatisticalIndex {
+struct GlobalMatch;
+}
+/// \endcond DO_NOT_DOCUMENT
 
 /*!
   \brief The UNStatisticalCodes class contains the Enlish language
@@ -29,17 +36,6 @@ delimitation of its frontiers or boundaries.
 
 class UNStatisticalCodes
 {
-  class RegionalNames
-  {
-  public:
-    QVector<QString> getNames();
-    int regionIndex(const QString& name);
-    void addCode(const QString& region);
-
-  protected:
-    QVector<QString> REGIONS;
-  }; // end internal UNStatisticalCodesBase
-
 public:
   //! Supported languages. These are the only languages shown
   //! on the UN website.
@@ -52,58 +48,188 @@ public:
     Spanish, //!< Spanish language names
     Arabic,  //!< Arabic language names
   };
-  UNStatisticalCodes();
+
+  //! How findName() compares names.
+  enum NameMatching
+  {
+    ExactMatch,      //!< The name must match exactly.
+    NormalisedMatch, //!< Names are compared by their normalisedName().
+  };
+  /*!
+    \brief A single country or area matched by findName().
+   */
+  struct NameMatch
+  {
+    //! The M49 code of the country or area, or -1 for no match.
+    int m49 = -1;
+    //! One bit, (1 << Language), for each language that uses the name.
+    int languages = 0;
+
+    //! Returns true if the name is used in the language.
+    bool hasLanguage(Language lang) const { return languages & (1 << lang); }
+  };
+
+  /*!
+    \brief The countries or areas matched by findName().
+
+    This is a lightweight view into the constant name tables so copying it
+    costs nothing. There is usually a single match, possibly used by several
+    languages ("Togo" is the English, French and Spanish name), but every
+    country or area using the name is returned.
+   */
+  class NameMatches
+  {
+  public:
+    //! Constructs an empty set of matches.
+    NameMatches() = default;
+
+    //! Returns the number of matched countries or areas.
+    int size() const { return m_count; }
+    //! Returns true if nothing matched.
+    bool isEmpty() const { return m_count == 0; }
+    //! Returns match i, or an invalid NameMatch if i is out of range.
+    NameMatch at(int i) const;
+    //! Returns the M49 code of the first match, or -1 if nothing matched.
+    int m49() const;
+    //! Returns the first language of the first match. Only meaningful if
+    //! something matched.
+    Language language() const;
+
+  private:
+    friend class UNStatisticalCodes;
+    NameMatches(const UNStatisticalIndex::GlobalMatch* matches, int count);
+
+    const UNStatisticalIndex::GlobalMatch* m_matches = nullptr;
+    int m_count = 0;
+  };
+
+  //! \brief Constructs a UNStatisticalCodes object.
+  //!
+  //! A UNStatisticalCodes object is only a handle. The codes and names are held
+  //! in constant read-only tables, and the QString forms returned by names(),
+  //! m49() and alphaCode() are built once per process the first time they are
+  //! needed and are shared by every handle. Construction costs nothing and all
+  //! methods are safe to call from any thread.
+  UNStatisticalCodes() = default;
+
+  //! \brief Returns the process wide UNStatisticalCodes handle.
+  static const UNStatisticalCodes& instance();
 
   //! \brief Returns a QVector<QString> containing all of the UN statistical named
   //! areas.
-  QVector<QString> names(Language lang);
+  QVector<QString> names(Language lang) const;
+
+  //! \brief Returns the name of the M49 country or area in the language, or
+  //! an empty string if the code is not valid.
+  QString name(Language lang, int m49) const;
+
+  //! \brief Returns the names in the language, sorted for the locale.
+  //!
+  //! The sorted list is built from collation sort keys once per language and
+  //! locale and then cached, so later calls only return a shared copy.
+  QVector<QString> sortedNames(Language lang,
+                               const QLocale& locale = QLocale()) const;
 
   //! \brief returns the numerical code for the UN area as an integer value.
   //!
   //! Normally these codes are required as a three character code. For this
   //! use the static m49(const QString&) method.
-  int m49AsInt(Language lang, const QString& name);
+  int m49AsInt(Language lang, const QString& name) const;
+
+  //! \brief Finds the name in all six languages at once.
+  //!
+  //! Returns every country or area that uses the name, each with the
+  //! languages that use it. This is a single hash lookup however many
+  //! languages are involved.
+  //!
+  //! With NormalisedMatch the name is compared by its normalisedName() so
+  //! that "cote d'ivoire", "CÔTE D’IVOIRE" and "Côte d’Ivoire" all match. The
+  //! normalised names are precomputed and hashed, once per process, so this
+  //! only costs the normalisation of the supplied name over an exact match.
+  NameMatches findName(const QString& name,
+                       NameMatching matching = ExactMatch) const;
+
+  //! \brief Returns the normalised form of a name, as used by findName().
+  //!
+  //! The name is case folded, accents and other combining marks are removed,
+  //! apostrophes are dropped and any run of other punctuation, symbols or
+  //! whitespace becomes a single space.
+  static QString normalisedName(const QString& name);
+
+  //! \brief Returns the numerical code for the UN area as an integer value,
+  //! whichever of the six languages the name is in.
+  //!
+  //! If more than one country or area uses the name the first is returned,
+  //! use findName() to recover all of them.
+  int m49AsInt(const QString& name) const;
 
   //! \brief Returns the numerical code for the UN area an a three character
   //! numerical code ("049" rather than an int).
   //!
   //! If you need the code as a numerical int value use m49AsInt(const
   //! QString&).
-  QString m49(Language lang, const QString& name);
+  QString m49(Language lang, const QString& name) const;
 
   //! \brief Returns the three character alpha code for the UN area as a
   //! QString.
-  QString alphaCode(Language lang, const QString& name);
+  QString alphaCode(Language lang, const QString& name) const;
+
+  //! \brief Returns the three character alpha code for the M49 code, or an
+  //! empty QString if the code is not valid or has no alpha code.
+  QString alphaCode(int m49) const;
+
+  //! \brief Returns the M49 code for the three character alpha code as an
+  //! integer value, or -1 if the alpha code is not valid.
+  int m49FromAlphaCode(const QString& alpha3) const;
+
+  //! \brief Returns the M49 code for the ISO 3166-1 alpha-2 code, for example
+  //! 840 for US, or -1 if the code is not assigned. Case is ignored.
+  //!
+  //! This is the ISO numeric code, which is the M49 code of the country or
+  //! area. Taiwan (TW, 158) is the only one that is not in the M49 table.
+  int m49FromAlpha2Code(const QString& alpha2) const;
 
   //! Checks whether the M49 (as an int) is a valid code. Returns true if it is,
   //! otherwise returns false.
-  bool isM49Valid(int value) { return M49CODES.contains(value); }
+  bool isM49Valid(int value) const;
 
   //! Checks whether the M49 (as a 3 digit QString) is a valid code. Returns
   //! true if it is, otherwise returns false.
-  bool isM49Valid(const QString& value);
+  bool isM49Valid(const QString& value) const;
 
   //! Checks whether the alpha 3 value is a valid code. Returns
   //! true if it is, otherwise returns false.
-  bool isAlpha3Valid(const QString& value)
-  {
-    return ALPHA3CODES.contains(value);
-  }
+  bool isAlpha3Valid(const QString& value) const;
+
+  //! Checks whether the M49 code (as an int) is a UN region, such as 419 for
+  //! Latin America and the Caribbean, rather than a country or area. Returns
+  //! true if it is, otherwise returns false.
+  bool isRegion(int value) const;
+
+  //! Checks whether the M49 code (as a 3 digit QString) is a UN region.
+  //! Returns true if it is, otherwise returns false.
+  bool isRegion(const QString& value) const;
+
+  //! \brief Returns the M49 code of the region that immediately contains the
+  //! supplied M49 country, area or region, or -1 if there is none.
+  //!
+  //! For example 32 (Argentina) returns 5 (South America), which returns 419
+  //! (Latin America and the Caribbean), then 19 (Americas) and then 1 (World).
+  int containingRegion(int value) const;
+
+  //! \brief Returns true if the M49 country, area or region lies within the
+  //! M49 region, otherwise returns false.
+  //!
+  //! A region contains itself. This is answered by a single lookup whatever
+  //! the depth of the two codes in the hierarchy.
+  bool regionContains(int region, int value) const;
+
+  //! \brief Returns true if the M49 country, area or region (as a 3 digit
+  //! QString) lies within the M49 region, otherwise returns false.
+  bool regionContains(const QString& region, const QString& value) const;
 
 private:
-  QVector<int> M49CODES;
-  QVector<QString> ALPHA3CODES;
-
-  RegionalNames m_english;
-  RegionalNames m_russian;
-  RegionalNames m_french;
-  RegionalNames m_spanish;
-  RegionalNames m_chinese;
-  RegionalNames m_arabic;
-
-  void addCodes();
-  void addCode(int m49, const QString& alpha3);
-  int getIndexOfName(Language lang, const QString& name);
+  int getIndexOfName(Language lang, const QString& name) const;
 };
 
 #endif // UNSTATISTICAL_H
@@ -0,0 +1,94 @@
+#ifndef BOUNDEDCACHE_H
+#define BOUNDEDCACHE_H
+
+#include <QCache>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QtGlobal>
+
+#include <atomic>
+
+/// \cond DO_NOT_DOCUMENT
+/*!
+  \class BoundedCache boundedcache.h
+  \brief A size bounded cache that can be shared between threads.
+
+  The entries are spread over a number of shards, each a QCache with its own
+  mutex, so that readers on different threads rarely wait for each other. Each
+  shard discards its least recently used entries once it is full.
+
+  Values are returned by copy, so Value should be cheap to copy, for example
+  an implicitly shared QString.
+
+  A value computed from data that was cleared while it was being computed is
+  not cached, see generation().
+ */
+template<typename Key, typename Value, int SHARDS = 16>
+class BoundedCache
+{
+public:
+  //! Constructs a cache that holds at most maxEntries values.
+  explicit BoundedCache(int maxEntries)
+  {
+    auto perShard = qMax(1, maxEntries / SHARDS);
+    for (auto& shard : m_shards)
+      shard.cache.setMaxCost(perShard);
+  }
+
+  //! \brief Copies the cached value for key into value.
+  //!
+  //! Returns true if the key was cached, otherwise returns false and leaves
+  //! value unchanged.
+  bool find(const Key& key, Value& value)
+  {
+    auto& shard = shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    auto cached = shard.cache.object(key);
+    if (!cached)
+      return false;
+    value = *cached;
+    return true;
+  }
+
+  //! \brief Returns the current generation, which changes on every clear().
+  //!
+  //! Read this before computing a value and pass it to insert().
+  quint64 generation() const { return m_generation.load(); }
+
+  //! \brief Caches the value for key, replacing any existing value, unless
+  //! the cache has been cleared since generation.
+  void insert(const Key& key, const Value& value, quint64 generation)
+  {
+    auto& shard = shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    if (generation == m_generation.load())
+      shard.cache.insert(key, new Value(value));
+  }
+
+  //! Removes all of the cached values.
+  void clear()
+  {
+    m_generation++;
+    for (auto& shard : m_shards) {
+      QMutexLocker locker(&shard.mutex);
+      shard.cache.clear();
+    }
+  }
+
+private:
+  struct Shard
+  {
+    QMutex mutex;
+    QCache<Key, Value> cache;
+  };
+  Shard m_shards[SHARDS];
+  std::atomic<quint64> m_generation{ 0 };
+
+  Shard& shardFor(const Key& key)
+  {
+    return m_shards[qHash(key) % SHARDS];
+  }
+};
+/// \endcond DO_NOT_DOCUMENT
+
+#endif // BOUNDEDCACHE_H
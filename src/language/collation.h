@@ -0,0 +1,110 @@
+#ifndef COLLATION_H
+#define COLLATION_H
+
+#include <QCollator>
+#include <QHash>
+#include <QLocale>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QString>
+#include <QVector>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+/// \cond DO_NOT_DOCUMENT
+/*!
+  \file collation.h
+  \brief Locale aware sorting of the name and description lists.
+
+  Sorting by QCollator::compare() collates both strings on every comparison,
+  which is slow for large lists and for scripts such as Arabic and Chinese.
+  Instead a sort key is built once per string and the keys are compared. The
+  sorted lists are then cached per list and per locale so that later requests
+  only copy an implicitly shared QVector.
+ */
+namespace Collation {
+
+//! \brief Returns a copy of the list sorted for the locale.
+//!
+//! Strings that collate equally keep their original order.
+inline QVector<QString>
+sorted(const QVector<QString>& list, const QLocale& locale)
+{
+  QCollator collator(locale);
+  std::vector<QCollatorSortKey> keys;
+  keys.reserve(std::size_t(list.size()));
+  for (auto& value : list)
+    keys.push_back(collator.sortKey(value));
+
+  std::vector<int> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](int a, int b) {
+    return keys[std::size_t(a)].compare(keys[std::size_t(b)]) < 0;
+  });
+
+  QVector<QString> result;
+  result.reserve(list.size());
+  for (auto index : order)
+    result.append(list.at(index));
+  return result;
+}
+
+/*!
+  \brief A thread safe cache of sorted lists.
+
+  Each list is identified by an integer id and is cached once per locale. The
+  cache only ever grows by the number of lists times the number of display
+  locales actually requested, which is small, so nothing is evicted. Call
+  clear() when the source lists change.
+ */
+class SortedLists
+{
+public:
+  //! \brief Returns the list identified by id sorted for the locale.
+  //!
+  //! source() is only called, to supply the unsorted list, the first time a
+  //! list is requested for a locale.
+  template<typename Source>
+  QVector<QString> sorted(int id, const QLocale& locale, Source source)
+  {
+    // name() leaves out the script, so zh_Hant_TW and zh_Hans_TW would share
+    // a list.
+    auto key = qMakePair(id, locale.bcp47Name());
+    quint64 generation;
+    {
+      QMutexLocker locker(&m_mutex);
+      auto it = m_lists.constFind(key);
+      if (it != m_lists.constEnd())
+        return it.value();
+      generation = m_generation;
+    }
+
+    // sort outside the lock, if two threads race the result is the same.
+    auto list = Collation::sorted(source(), locale);
+    QMutexLocker locker(&m_mutex);
+    // a list sorted from data that has since been cleared is not kept.
+    if (generation == m_generation)
+      m_lists.insert(key, list);
+    return list;
+  }
+
+  //! Removes all of the cached lists.
+  void clear()
+  {
+    QMutexLocker locker(&m_mutex);
+    m_lists.clear();
+    m_generation++;
+  }
+
+private:
+  QMutex m_mutex;
+  quint64 m_generation = 0;
+  QHash<QPair<int, QString>, QVector<QString>> m_lists;
+};
+
+} // end of namespace Collation
+/// \endcond DO_NOT_DOCUMENT
+
+#endif // COLLATION_H
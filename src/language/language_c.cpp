@@ -0,0 +1,190 @@
+#include "language/language_c.h"
+#include "language/bcp47core.h"
+#include "language/languages.h"
+
+struct lang_snapshot
+{
+  //! keeps the image of a published snapshot alive, empty for open().
+  BCP47Snapshot snapshot;
+  BCP47Core::Registry registry;
+};
+
+namespace {
+
+static_assert(int(LANG_TYPE_PRIVATE_USE) == int(BCP47Core::PrivateUse),
+              "the C types must match BCP47Core::Type");
+static_assert(int(LANG_DUPLICATE_SINGLETON) ==
+                int(BCP47Core::DuplicateSingleton),
+              "the C errors must match BCP47Core::Error");
+static_assert(int(LANG_FLAG_COLLECTION) == int(RegistryImage::Collection),
+              "the C flags must match RegistryImage::RecordFlag");
+
+std::string_view
+view(const char* data, size_t length)
+{
+  return data ? std::string_view(data, length) : std::string_view();
+}
+
+lang_string
+cString(std::string_view value)
+{
+  return lang_string{ value.data(), value.size() };
+}
+
+void
+setResult(lang_result* result, const BCP47Core::Result& value)
+{
+  if (!result)
+    return;
+  result->error = value.error;
+  result->error_subtag = uint32_t(value.errorSubtag);
+  result->count = uint32_t(value.count);
+}
+
+} // end of anonymous namespace
+
+lang_snapshot*
+lang_snapshot_current(void)
+{
+  auto snapshot = BCP47Languages::snapshot();
+  return new lang_snapshot{ snapshot, snapshot.core() };
+}
+
+lang_snapshot*
+lang_snapshot_open(const void* data, size_t size)
+{
+  BCP47Core::Registry registry(data, size);
+  if (!registry.isValid())
+    return nullptr;
+  return new lang_snapshot{ BCP47Snapshot(), registry };
+}
+
+void
+lang_snapshot_release(lang_snapshot* snapshot)
+{
+  delete snapshot;
+}
+
+uint32_t
+lang_snapshot_file_date(const lang_snapshot* snapshot)
+{
+  return snapshot ? snapshot->registry.view().fileDate() : 0;
+}
+
+int32_t
+lang_validate(const lang_snapshot* snapshot,
+              const char* tag,
+              size_t length,
+              lang_result* result)
+{
+  if (!snapshot)
+    return LANG_INVALID_ARGUMENT;
+  auto value = snapshot->registry.validate(view(tag, length));
+  setResult(result, value);
+  return value.error;
+}
+
+size_t
+lang_validate_batch(const lang_snapshot* snapshot,
+                    const lang_string* tags,
+                    size_t count,
+                    lang_result* results)
+{
+  if (!snapshot || !tags)
+    return 0;
+  size_t valid = 0;
+  for (size_t i = 0; i < count; i++) {
+    auto value =
+      snapshot->registry.validate(view(tags[i].data, tags[i].length));
+    setResult(results ? results + i : nullptr, value);
+    if (value.isValid())
+      valid++;
+  }
+  return valid;
+}
+
+int32_t
+lang_classify(const lang_snapshot* snapshot,
+              const char* tag,
+              size_t length,
+              lang_subtag* subtags,
+              size_t capacity,
+              lang_result* result)
+{
+  if (!snapshot)
+    return LANG_INVALID_ARGUMENT;
+  // the structs differ in the width of the type, so each is converted.
+  BCP47Core::Subtag found[LANG_MAX_SUBTAGS];
+  auto value = snapshot->registry.classify(
+    view(tag, length), found, LANG_MAX_SUBTAGS);
+  size_t written = value.count < capacity ? value.count : capacity;
+  if (written > LANG_MAX_SUBTAGS)
+    written = LANG_MAX_SUBTAGS;
+  for (size_t i = 0; subtags && i < written; i++) {
+    subtags[i].start = found[i].start;
+    subtags[i].length = found[i].length;
+    subtags[i].type = found[i].type;
+  }
+  setResult(result, value);
+  return value.error;
+}
+
+size_t
+lang_canonicalize(const lang_snapshot* snapshot,
+                  const char* tag,
+                  size_t length,
+                  char* out,
+                  size_t capacity)
+{
+  if (!snapshot)
+    return 0;
+  return snapshot->registry.canonicalise(
+    view(tag, length), out, out ? capacity : 0);
+}
+
+size_t
+lang_canonicalize_batch(const lang_snapshot* snapshot,
+                        const lang_string* tags,
+                        size_t count,
+                        char* out,
+                        size_t capacity,
+                        lang_string* results)
+{
+  if (!snapshot || !tags)
+    return 0;
+  size_t total = 0;
+  for (size_t i = 0; i < count; i++) {
+    auto room = out && total < capacity ? capacity - total : 0;
+    auto length = snapshot->registry.canonicalise(
+      view(tags[i].data, tags[i].length), room ? out + total : nullptr, room);
+    if (results)
+      results[i] = lang_string{ room ? out + total : nullptr, length };
+    total += length;
+  }
+  return total;
+}
+
+int
+lang_lookup(const lang_snapshot* snapshot,
+            uint32_t type,
+            const char* subtag,
+            size_t length,
+            lang_record* record)
+{
+  if (!snapshot || type > LANG_TYPE_REDUNDANT)
+    return 0;
+  auto& image = snapshot->registry.view();
+  auto found =
+    snapshot->registry.lookup(BCP47Core::Type(type), view(subtag, length));
+  if (!found)
+    return 0;
+  if (record) {
+    record->subtag = cString(image.string(found->subtag));
+    record->tag = cString(image.string(found->tag));
+    record->description = cString(image.listAt(found->descriptions, 0));
+    record->preferred_value = cString(image.string(found->preferredValue));
+    record->description_count = image.listSize(found->descriptions);
+    record->flags = found->flags;
+  }
+  return 1;
+}
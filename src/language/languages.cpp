@@ -1,8 +1,24 @@
 #include "language/languages.h"
+#include "language/boundedcache.h"
+#include "language/collation.h"
+#include "language/bcp47core.h"
+
+#include <QDateTime>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QReadWriteLock>
+#include <QSaveFile>
+#include <QSet>
+#include <QThreadPool>
+#include <QTimer>
+#include <QtConcurrent>
+
+#include <cstring>
+#include <functional>
 
 //#include <string>
 #include "utilities/stringutil.h"
-#include "utilities/filedownloader.h"
 #include "qyamlcpp/qyamlcpp.h"
 
 //====================================================================
@@ -269,9 +285,924 @@ BCP47Language::typeString()
   return QString();
 }
 
+//====================================================================
+//=== BCP47Snapshot
+//====================================================================
+/*!
+  \brief The indexes of a BCP47Snapshot, never modified once built.
+ */
+struct BCP47Snapshot::Data
+{
+  QDate fileDate;
+  QMultiMap<QString, QSharedPointer<BCP47Language>> datasetByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> languageByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> languageBySubtag;
+  QMap<QString, QSharedPointer<BCP47Language>> extlangByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> extlangBySubtag;
+  QMap<QString, QSharedPointer<BCP47Language>> regionByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> regionBySubtag;
+  QMap<QString, QSharedPointer<BCP47Language>> scriptByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> scriptBySubtag;
+  QMap<QString, QSharedPointer<BCP47Language>> variantByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> variantBySubtag;
+  // some grandfathered descriptions are NOT unique.
+  QMultiMap<QString, QSharedPointer<BCP47Language>> grandfatheredByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> grandfatheredByTag;
+  QMap<QString, QSharedPointer<BCP47Language>> redundantByDescription;
+  QMap<QString, QSharedPointer<BCP47Language>> redundantByTag;
+  // the join between region subtags and the UN M49 codes.
+  QHash<QString, int> m49ByRegionSubtag;
+  QVector<QString> regionSubtagByM49;
+  // the flat image of the indexes, which the tag checks search.
+  QByteArray image;
+  BCP47Core::Registry core;
+};
+
+BCP47Snapshot::BCP47Snapshot()
+{
+  // every empty snapshot shares the same empty data.
+  static const QSharedPointer<const Data> empty(new Data());
+  d = empty;
+}
+
+namespace {
+
+//! Returns the key a record is indexed by within its type.
+QPair<int, QString>
+recordKey(const BCP47Language& language)
+{
+  auto type = language.type();
+  auto byTag =
+    type == BCP47Language::GRANDFATHERED || type == BCP47Language::REDUNDANT;
+  return qMakePair(int(type), byTag ? language.tag() : language.subtag());
+}
+
+//! Returns true if the two records hold exactly the same registry entry.
+bool
+sameRecord(const BCP47Language& a, const BCP47Language& b)
+{
+  return a.type() == b.type() && a.subtag() == b.subtag() &&
+         a.tag() == b.tag() && a.descriptions() == b.descriptions() &&
+         a.dateAdded() == b.dateAdded() &&
+         a.suppressScriptLang() == b.suppressScriptLang() &&
+         a.macrolanguageName() == b.macrolanguageName() &&
+         a.isCollection() == b.isCollection() &&
+         a.isMacrolanguage() == b.isMacrolanguage() &&
+         a.comments() == b.comments() &&
+         a.isDeprecated() == b.isDeprecated() &&
+         a.preferredValue() == b.preferredValue() && a.prefix() == b.prefix();
+}
+
+} // end of anonymous namespace
+
+BCP47Snapshot
+BCP47Snapshot::build(
+  const QMultiMap<QString, QSharedPointer<BCP47Language>>& dataset,
+  const QDate& fileDate)
+{
+  auto data = new Data();
+  data->fileDate = fileDate;
+  data->datasetByDescription = dataset;
+  updateMaps(*data);
+  return seal(data);
+}
+
+BCP47Snapshot
+BCP47Snapshot::update(
+  const BCP47Snapshot& previous,
+  const QMultiMap<QString, QSharedPointer<BCP47Language>>& dataset,
+  const QDate& fileDate)
+{
+  if (previous.isEmpty())
+    return build(dataset, fileDate);
+
+  // the new records by key, where a key is repeated the last record is kept
+  // as it is by the full build.
+  QHash<QPair<int, QString>, QSharedPointer<BCP47Language>> records;
+  for (auto it = dataset.constBegin(); it != dataset.constEnd(); ++it)
+    records.insert(recordKey(*it.value()), it.value());
+
+  // the records that are new or differ in any field, and those they replace.
+  QVector<QSharedPointer<BCP47Language>> added, removed;
+  for (auto it = records.constBegin(); it != records.constEnd(); ++it) {
+    auto type = BCP47Language::Type(it.key().first);
+    auto old = previous.fromSubtag(type, it.key().second);
+    if (old && sameRecord(*old, *it.value()))
+      continue;
+    if (old)
+      removed.append(old);
+    added.append(it.value());
+  }
+  // and the records that are no longer in the registry at all.
+  QSet<const BCP47Language*> seen;
+  auto& oldDataset = previous.d->datasetByDescription;
+  for (auto it = oldDataset.constBegin(); it != oldDataset.constEnd(); ++it) {
+    auto& old = it.value();
+    if (!records.contains(recordKey(*old)) && !seen.contains(old.data())) {
+      seen.insert(old.data());
+      removed.append(old);
+    }
+  }
+
+  // nothing changed, so the previous snapshot is kept.
+  if (added.isEmpty() && removed.isEmpty() && fileDate == previous.fileDate())
+    return previous;
+
+  // a large change is cheaper to index from scratch.
+  if ((added.size() + removed.size()) * 4 > records.size())
+    return build(dataset, fileDate);
+
+  // unchanged records and the maps that hold them are shared with the
+  // previous snapshot, so only the changed entries are touched.
+  auto data = new Data(*previous.d);
+  data->fileDate = fileDate;
+  for (auto& language : removed) {
+    for (auto& description : language->descriptions())
+      data->datasetByDescription.remove(description, language);
+  }
+  for (auto& language : added) {
+    for (auto& description : language->descriptions())
+      data->datasetByDescription.insert(description, language);
+  }
+
+  auto reindex = [data, &added, &removed](BCP47Language::Type type,
+                                          auto& byDescription,
+                                          auto& byKey,
+                                          bool byTag) {
+    QSet<QString> descriptions;
+    for (auto& language : removed) {
+      if (language->type() != type)
+        continue;
+      byKey.remove(byTag ? language->tag() : language->subtag());
+      for (auto& description : language->descriptions())
+        descriptions.insert(description);
+    }
+    for (auto& language : added) {
+      if (language->type() != type)
+        continue;
+      byKey.insert(byTag ? language->tag() : language->subtag(), language);
+      for (auto& description : language->descriptions())
+        descriptions.insert(description);
+    }
+    // a description can be shared by several records, so each one touched is
+    // indexed again from the dataset in the order the full build uses.
+    auto& dataset = data->datasetByDescription;
+    for (auto& description : descriptions) {
+      byDescription.remove(description);
+      for (auto it = dataset.constFind(description);
+           it != dataset.constEnd() && it.key() == description;
+           ++it) {
+        if (it.value()->type() == type)
+          byDescription.insert(description, it.value());
+      }
+    }
+    return !descriptions.isEmpty();
+  };
+
+  reindex(BCP47Language::LANGUAGE,
+          data->languageByDescription,
+          data->languageBySubtag,
+          false);
+  reindex(BCP47Language::EXTLANG,
+          data->extlangByDescription,
+          data->extlangBySubtag,
+          false);
+  if (reindex(BCP47Language::REGION,
+              data->regionByDescription,
+              data->regionBySubtag,
+              false)) {
+    data->m49ByRegionSubtag.clear();
+    updateRegionJoin(*data);
+  }
+  reindex(BCP47Language::SCRIPT,
+          data->scriptByDescription,
+          data->scriptBySubtag,
+          false);
+  reindex(BCP47Language::VARIANT,
+          data->variantByDescription,
+          data->variantBySubtag,
+          false);
+  reindex(BCP47Language::GRANDFATHERED,
+          data->grandfatheredByDescription,
+          data->grandfatheredByTag,
+          true);
+  reindex(BCP47Language::REDUNDANT,
+          data->redundantByDescription,
+          data->redundantByTag,
+          true);
+  return seal(data);
+}
+
+BCP47Snapshot
+BCP47Snapshot::seal(Data* data)
+{
+  BCP47Snapshot snapshot;
+  snapshot.d = QSharedPointer<const Data>(data);
+  // the image is written from the finished maps, before anyone else sees it.
+  data->image = snapshot.writeImage();
+  data->core = BCP47Core::Registry(data->image.constData(),
+                                   std::size_t(data->image.size()));
+  return snapshot;
+}
+
+void
+BCP47Snapshot::updateMaps(Data& data)
+{
+  // split the records by type, keeping the dataset order so that where a
+  // description is repeated within a type the same record is kept as before.
+  using Record = QPair<QString, QSharedPointer<BCP47Language>>;
+  QHash<int, QVector<Record>> recordsByType;
+  for (auto it = data.datasetByDescription.constBegin();
+       it != data.datasetByDescription.constEnd();
+       ++it)
+    recordsByType[it.value()->type()].append(qMakePair(it.key(), it.value()));
+
+  // each type is indexed on its own thread, and only writes its own maps.
+  // This runs on the refresh pool itself, so the global pool is used rather
+  // than waiting on tasks that are queued behind this one.
+  QVector<QFuture<void>> builds;
+  auto index = [&recordsByType, &builds](BCP47Language::Type type,
+                                         auto& byDescription,
+                                         auto& byKey,
+                                         bool byTag,
+                                         std::function<void()> then) {
+    auto records = recordsByType.value(type);
+    builds.append(QtConcurrent::run([records, &byDescription, &byKey, byTag,
+                                     then]() {
+      for (auto& record : records) {
+        auto& language = record.second;
+        byDescription.insert(record.first, language);
+        byKey.insert(byTag ? language->tag() : language->subtag(), language);
+      }
+      if (then)
+        then();
+    }));
+  };
+
+  index(BCP47Language::LANGUAGE,
+        data.languageByDescription,
+        data.languageBySubtag,
+        false,
+        nullptr);
+  index(BCP47Language::EXTLANG,
+        data.extlangByDescription,
+        data.extlangBySubtag,
+        false,
+        nullptr);
+  // the region join only needs the region maps, so follows them directly.
+  index(BCP47Language::REGION,
+        data.regionByDescription,
+        data.regionBySubtag,
+        false,
+        [&data]() { updateRegionJoin(data); });
+  index(BCP47Language::SCRIPT,
+        data.scriptByDescription,
+        data.scriptBySubtag,
+        false,
+        nullptr);
+  index(BCP47Language::VARIANT,
+        data.variantByDescription,
+        data.variantBySubtag,
+        false,
+        nullptr);
+  index(BCP47Language::GRANDFATHERED,
+        data.grandfatheredByDescription,
+        data.grandfatheredByTag,
+        true,
+        nullptr);
+  index(BCP47Language::REDUNDANT,
+        data.redundantByDescription,
+        data.redundantByTag,
+        true,
+        nullptr);
+
+  for (auto& build : builds)
+    build.waitForFinished();
+}
+
+void
+BCP47Snapshot::updateRegionJoin(Data& data)
+{
+  auto& unStatistical = UNStatisticalCodes::instance();
+  // M49 codes are three digits so the reverse direction is a direct index.
+  data.m49ByRegionSubtag.reserve(data.regionBySubtag.size());
+  data.regionSubtagByM49 = QVector<QString>(1000);
+
+  for (auto it = data.regionBySubtag.constBegin();
+       it != data.regionBySubtag.constEnd();
+       ++it) {
+    auto& subtag = it.key();
+    auto m49 = -1;
+    if (subtag.size() == 3 && subtag.at(0).isDigit()) {
+      // numeric subtags are M49 codes.
+      bool ok;
+      auto value = subtag.toInt(&ok);
+      if (ok && (unStatistical.isM49Valid(value) ||
+                 unStatistical.isRegion(value)))
+        m49 = value;
+    } else if (unStatistical.m49FromAlpha2Code(subtag) >= 0) {
+      // alphabetic subtags are ISO 3166-1 codes, whose numeric codes are M49
+      // codes. The IANA and UN names often differ, so names are no use here.
+      m49 = unStatistical.m49FromAlpha2Code(subtag);
+    } else {
+      // codes withdrawn from ISO 3166-1, such as BU, are linked by name,
+      // exactly if possible.
+      auto descriptions = it.value()->descriptions();
+      for (auto matching : { UNStatisticalCodes::ExactMatch,
+                             UNStatisticalCodes::NormalisedMatch }) {
+        for (auto& description : descriptions) {
+          auto matches = unStatistical.findName(description, matching);
+          if (matches.size() == 1) {
+            m49 = matches.m49();
+            break;
+          }
+        }
+        if (m49 >= 0)
+          break;
+      }
+    }
+
+    if (m49 < 0)
+      continue;
+    data.m49ByRegionSubtag.insert(subtag, m49);
+    // deprecated subtags must not hide the current one.
+    auto& current = data.regionSubtagByM49[m49];
+    if (current.isEmpty() || data.regionBySubtag.value(current)->isDeprecated())
+      current = subtag;
+  }
+}
+
+bool
+BCP47Snapshot::isEmpty() const
+{
+  return d->datasetByDescription.isEmpty();
+}
+
+QDate
+BCP47Snapshot::fileDate() const
+{
+  return d->fileDate;
+}
+
+QMultiMap<QString, QSharedPointer<BCP47Language>>
+BCP47Snapshot::dataset() const
+{
+  return d->datasetByDescription;
+}
+
+QSharedPointer<BCP47Language>
+BCP47Snapshot::fromSubtag(BCP47Language::Type type, const QString& subtag) const
+{
+  switch (type) {
+    case BCP47Language::LANGUAGE:
+      return d->languageBySubtag.value(subtag);
+    case BCP47Language::EXTLANG:
+      return d->extlangBySubtag.value(subtag);
+    case BCP47Language::SCRIPT:
+      return d->scriptBySubtag.value(subtag);
+    case BCP47Language::REGION:
+      return d->regionBySubtag.value(subtag);
+    case BCP47Language::VARIANT:
+      return d->variantBySubtag.value(subtag);
+    case BCP47Language::GRANDFATHERED:
+      return d->grandfatheredByTag.value(subtag);
+    case BCP47Language::REDUNDANT:
+      return d->redundantByTag.value(subtag);
+    default:
+      return QSharedPointer<BCP47Language>();
+  }
+}
+
+QSharedPointer<BCP47Language>
+BCP47Snapshot::fromDescription(BCP47Language::Type type,
+                               const QString& description) const
+{
+  switch (type) {
+    case BCP47Language::LANGUAGE:
+      return d->languageByDescription.value(description);
+    case BCP47Language::EXTLANG:
+      return d->extlangByDescription.value(description);
+    case BCP47Language::SCRIPT:
+      return d->scriptByDescription.value(description);
+    case BCP47Language::REGION:
+      return d->regionByDescription.value(description);
+    case BCP47Language::VARIANT:
+      return d->variantByDescription.value(description);
+    case BCP47Language::GRANDFATHERED:
+      return d->grandfatheredByDescription.value(description);
+    case BCP47Language::REDUNDANT:
+      return d->redundantByDescription.value(description);
+    default:
+      return QSharedPointer<BCP47Language>();
+  }
+}
+
+bool
+BCP47Snapshot::contains(BCP47Language::Type type, const QString& subtag) const
+{
+  return !fromSubtag(type, subtag).isNull();
+}
+
+QVector<QString>
+BCP47Snapshot::subtags(BCP47Language::Type type) const
+{
+  switch (type) {
+    case BCP47Language::LANGUAGE:
+      return d->languageBySubtag.keys();
+    case BCP47Language::EXTLANG:
+      return d->extlangBySubtag.keys();
+    case BCP47Language::SCRIPT:
+      return d->scriptBySubtag.keys();
+    case BCP47Language::REGION:
+      return d->regionBySubtag.keys();
+    case BCP47Language::VARIANT:
+      return d->variantBySubtag.keys();
+    case BCP47Language::GRANDFATHERED:
+      return d->grandfatheredByTag.keys();
+    case BCP47Language::REDUNDANT:
+      return d->redundantByTag.keys();
+    default:
+      return QVector<QString>();
+  }
+}
+
+QVector<QString>
+BCP47Snapshot::descriptions(BCP47Language::Type type) const
+{
+  switch (type) {
+    case BCP47Language::LANGUAGE:
+      return d->languageByDescription.keys();
+    case BCP47Language::EXTLANG:
+      return d->extlangByDescription.keys();
+    case BCP47Language::SCRIPT:
+      return d->scriptByDescription.keys();
+    case BCP47Language::REGION:
+      return d->regionByDescription.keys();
+    case BCP47Language::VARIANT:
+      return d->variantByDescription.keys();
+    case BCP47Language::GRANDFATHERED:
+      return d->grandfatheredByDescription.keys();
+    case BCP47Language::REDUNDANT:
+      return d->redundantByDescription.keys();
+    default:
+      return QVector<QString>();
+  }
+}
+
+namespace {
+
+//! Builds a RegistryImage, see registryimage.h.
+class ImageWriter
+{
+public:
+  ImageWriter() { m_image.fill('\0', int(sizeof(RegistryImage::Header))); }
+
+  //! Appends the string, once, and returns its offset.
+  uint32_t string(const QString& value)
+  {
+    if (value.isEmpty())
+      return 0;
+    auto it = m_strings.constFind(value);
+    if (it != m_strings.constEnd())
+      return it.value();
+    auto utf8 = value.toUtf8();
+    auto length = uint32_t(utf8.size());
+    auto offset = append(&length, sizeof(length));
+    m_image.append(utf8);
+    m_strings.insert(value, offset);
+    return offset;
+  }
+
+  //! Appends the strings and a list of them and returns the list's offset.
+  uint32_t list(const QVector<QString>& values)
+  {
+    if (values.isEmpty())
+      return 0;
+    QVector<uint32_t> offsets;
+    offsets.append(uint32_t(values.size()));
+    for (auto& value : values)
+      offsets.append(string(value));
+    return append(offsets.constData(), offsets.size() * sizeof(uint32_t));
+  }
+
+  //! Appends size bytes at the next aligned offset and returns the offset.
+  uint32_t append(const void* data, std::size_t size)
+  {
+    while (m_image.size() % sizeof(uint32_t) != 0)
+      m_image.append('\0');
+    auto offset = uint32_t(m_image.size());
+    m_image.append(static_cast<const char*>(data), int(size));
+    return offset;
+  }
+
+  uint32_t size() const { return uint32_t(m_image.size()); }
+
+  //! Returns the image with the header written at the start.
+  QByteArray image(const RegistryImage::Header& header)
+  {
+    std::memcpy(m_image.data(), &header, sizeof(header));
+    return m_image;
+  }
+
+private:
+  QByteArray m_image;
+  QHash<QString, uint32_t> m_strings;
+};
+
+uint32_t
+julianDay(const QDate& date)
+{
+  return date.isValid() ? uint32_t(date.toJulianDay()) : 0;
+}
+
+} // end of anonymous namespace
+
+QByteArray
+BCP47Snapshot::image() const
+{
+  return d->image;
+}
+
+BCP47Core::Registry
+BCP47Snapshot::core() const
+{
+  return d->core;
+}
+
+QByteArray
+BCP47Snapshot::writeImage() const
+{
+  using namespace RegistryImage;
+  ImageWriter writer;
+  Header header = {};
+  header.magic = MAGIC;
+  header.version = VERSION;
+  header.fileDate = julianDay(d->fileDate);
+
+  // the descriptions of each type, in dataset order.
+  QVector<QPair<QString, QSharedPointer<BCP47Language>>> described[TYPES];
+  for (auto it = d->datasetByDescription.constBegin();
+       it != d->datasetByDescription.constEnd();
+       ++it) {
+    auto type = int(it.value()->type());
+    if (type > BCP47Language::BAD_TAG && type < TYPES)
+      described[type].append(qMakePair(it.key(), it.value()));
+  }
+
+  for (int type = BCP47Language::LANGUAGE; type < TYPES; type++) {
+    auto wholeTag =
+      type == BCP47Language::GRANDFATHERED || type == BCP47Language::REDUNDANT;
+    QVector<QPair<QByteArray, QString>> keys;
+    for (auto& key : subtags(BCP47Language::Type(type)))
+      keys.append(qMakePair(key.toUtf8(), key));
+    std::sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) {
+      return a.first < b.first;
+    });
+
+    QVector<Record> records;
+    QHash<QString, uint32_t> indexes;
+    for (auto& key : keys) {
+      auto language = fromSubtag(BCP47Language::Type(type), key.second);
+      Record record = {};
+      record.key = writer.string(key.second);
+      record.subtag = writer.string(language->subtag());
+      record.tag = writer.string(language->tag());
+      record.descriptions = writer.list(language->descriptions());
+      record.preferredValue = writer.string(language->preferredValue());
+      record.suppressScript = writer.string(language->suppressScriptLang());
+      record.macrolanguage = writer.string(language->macrolanguageName());
+      record.comments = writer.string(language->comments());
+      record.prefixes = writer.list(language->prefix());
+      record.added = julianDay(language->dateAdded());
+      record.flags = 0;
+      if (language->isDeprecated())
+        record.flags |= Deprecated;
+      if (language->isMacrolanguage())
+        record.flags |= Macrolanguage;
+      if (language->isCollection())
+        record.flags |= Collection;
+      indexes.insert(key.second, uint32_t(records.size()));
+      records.append(record);
+    }
+
+    QVector<QPair<QByteArray, DescriptionEntry>> entries;
+    for (auto& pair : described[type]) {
+      auto& language = pair.second;
+      auto key = wholeTag ? language->tag() : language->subtag();
+      auto it = indexes.constFind(key);
+      if (it == indexes.constEnd())
+        continue;
+      entries.append(qMakePair(
+        pair.first.toUtf8(),
+        DescriptionEntry{ writer.string(pair.first), it.value() }));
+    }
+    // descriptions shared by several records keep the dataset order.
+    std::stable_sort(
+      entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+      });
+    QVector<DescriptionEntry> sorted;
+    sorted.reserve(entries.size());
+    for (auto& entry : entries)
+      sorted.append(entry.second);
+
+    auto& table = header.tables[type];
+    table.count = uint32_t(records.size());
+    if (table.count > 0)
+      table.records =
+        writer.append(records.constData(), records.size() * sizeof(Record));
+    table.descriptionCount = uint32_t(sorted.size());
+    if (table.descriptionCount > 0)
+      table.descriptions = writer.append(
+        sorted.constData(), sorted.size() * sizeof(DescriptionEntry));
+  }
+
+  header.size = writer.size();
+  return writer.image(header);
+}
+
 //====================================================================
 //=== BCP47Languages
 //====================================================================
+namespace {
+
+Collation::SortedLists&
+sortedDescriptionLists()
+{
+  static Collation::SortedLists lists;
+  return lists;
+}
+
+//! Tags up to this long are checked from the stack without allocating.
+constexpr std::size_t MAX_STACK_TAG = 256;
+
+//! \brief Copies an ASCII value into buffer and points key at it.
+//!
+//! Returns false if the value is too long or is not ASCII, in which case it
+//! cannot be a subtag.
+template<std::size_t N>
+bool
+asciiKey(const QString& value, char (&buffer)[N], std::string_view& key)
+{
+  if (std::size_t(value.size()) > N)
+    return false;
+  for (int i = 0; i < value.size(); i++) {
+    auto c = value.at(i).unicode();
+    if (c > 0x7f)
+      return false;
+    buffer[i] = char(c);
+  }
+  key = std::string_view(buffer, std::size_t(value.size()));
+  return true;
+}
+
+//! Returns true if the snapshot has the subtag, matching case.
+bool
+containsSubtag(const BCP47Snapshot& snapshot,
+               BCP47Core::Type type,
+               const QString& subtag)
+{
+  char buffer[BCP47Core::Registry::MAX_WHOLE_TAG];
+  std::string_view key;
+  return asciiKey(subtag, buffer, key) && snapshot.core().contains(type, key);
+}
+
+//! Returns true if the published registry has the subtag, matching case.
+bool
+containsSubtag(BCP47Core::Type type, const QString& subtag)
+{
+  return containsSubtag(BCP47Languages::snapshot(), type, subtag);
+}
+
+//! The display name cache, keyed by tag and display language.
+using DisplayNameCache = BoundedCache<QPair<QString, int>, QString>;
+
+DisplayNameCache&
+displayNameCache()
+{
+  static DisplayNameCache cache(4096);
+  return cache;
+}
+
+/*!
+  \brief The thread pool that runs the registry refresh stages.
+
+  One pool is shared by every BCP47Languages object so that the number of
+  threads is capped however many refreshes are requested.
+ */
+QThreadPool*
+pipelinePool()
+{
+  static QThreadPool pool;
+  static const bool initialised = [] {
+    pool.setMaxThreadCount(qBound(2, QThread::idealThreadCount(), 4));
+    return true;
+  }();
+  Q_UNUSED(initialised)
+  return &pool;
+}
+
+//! The output of the download and parse stages of a registry refresh.
+struct RegistryData
+{
+  QMultiMap<QString, QSharedPointer<BCP47Language>> languages;
+  QDate fileDate;
+  QMultiMap<int, LanguageParser::Errors> parsingErrors;
+  QString error;
+  //! False if a local file ended before all of its records were written.
+  bool complete = true;
+};
+
+//! \brief The version of the local YAML file.
+//!
+//! Files of this version end with a record count, files without a version
+//! were written before the count was added.
+constexpr int YAML_FORMAT_VERSION = 2;
+
+//! The installed download stage, see BCP47Languages::setRegistryDownloader().
+struct Downloader
+{
+  QMutex mutex;
+  BCP47Languages::RegistryDownloader download;
+};
+
+Downloader&
+registryDownloader()
+{
+  static Downloader downloader;
+  return downloader;
+}
+
+//! The parse stage, parses the downloaded registry data.
+RegistryData
+parseRegistry(const QByteArray& data)
+{
+  RegistryData result;
+  LanguageParser parser;
+  parser.setData(data);
+  QObject::connect(
+    &parser,
+    &LanguageParser::parseCompleted,
+    [&result](QMultiMap<QString, QSharedPointer<BCP47Language>> languages,
+              QDate fileDate,
+              bool) {
+      result.languages = languages;
+      result.fileDate = fileDate;
+    });
+  QObject::connect(&parser,
+                   &LanguageParser::parsingErrors,
+                   [&result](QMultiMap<int, LanguageParser::Errors> errors) {
+                     result.parsingErrors = errors;
+                   });
+  parser.parse();
+  return result;
+}
+
+//! Reads the registry data from a local YAML file.
+RegistryData
+readYamlFile(QFile& file)
+{
+  RegistryData result;
+  auto yaml = YAML::LoadFile(file);
+  if (yaml["file-date"]) {
+    auto node = yaml["file-date"];
+    result.fileDate = QDate::fromString(node.as<QString>(), Qt::ISODate);
+  }
+  int records = 0;
+  if (yaml["languages"]) {
+    auto languagesNode = yaml["languages"];
+    if (languagesNode && languagesNode.IsSequence()) {
+      for (auto languageNode : languagesNode) {
+        if (languageNode && languageNode.IsMap()) {
+          records++;
+          auto language = QSharedPointer<BCP47Language>(new BCP47Language());
+          if (languageNode["type"]) {
+            auto value = languageNode["type"].as<QString>();
+            language->setType(BCP47Language::fromString(value));
+          }
+          if (languageNode["subtag"]) {
+            auto value = languageNode["subtag"].as<QString>();
+            language->setSubtag(value);
+          }
+          if (languageNode["tag"]) {
+            auto value = languageNode["tag"].as<QString>();
+            language->setTag(value);
+          }
+          if (languageNode["added"]) {
+            auto value = languageNode["added"].as<QString>();
+            language->setDateAdded(QDate::fromString(value, Qt::ISODate));
+          }
+          if (languageNode["suppress-script"]) {
+            auto value = languageNode["suppress-script"].as<QString>();
+            language->setSuppressScript(value);
+          }
+          if (languageNode["macrolanguage"]) {
+            auto value = languageNode["macrolanguage"].as<QString>();
+            language->setMacrolanguageName(value);
+          }
+          if (languageNode["preferred-value"]) {
+            auto value = languageNode["preferred-value"].as<QString>();
+            language->setPreferredValue(value);
+          }
+          if (languageNode["scope"]) {
+            auto value = languageNode["scope"].as<QString>();
+            if (value == "deprecated")
+              language->setDeprecated(true);
+            else if (value == "collection")
+              language->setCollection(true);
+            else if (value == "macrolanguage")
+              language->setMacrolanguage(true);
+          }
+          auto descriptions = languageNode["description"];
+          if (descriptions && descriptions.IsSequence()) {
+            for (auto const& description : descriptions) {
+              language->addDescription(description.as<QString>());
+            }
+          }
+          auto prefixes = languageNode["prefix"];
+          if (prefixes && prefixes.IsSequence()) {
+            for (auto const& prefix : prefixes) {
+              language->addPrefix(prefix.as<QString>());
+            }
+          }
+          auto comments = languageNode["comments"];
+          if (comments && comments.IsScalar()) {
+            language->setComments(comments.as<QString>());
+          }
+          // save language data (multi language description supported)
+          for (auto& description : language->descriptions()) {
+            result.languages.insert(description, language);
+          }
+        }
+      }
+    }
+  }
+  // a file read while it is being written still parses, but it has no
+  // record count yet or the count does not match.
+  if (yaml["format-version"]) {
+    auto count = yaml["record-count"];
+    result.complete = count && count.IsScalar() && count.as<int>() == records;
+  }
+  return result;
+}
+
+
+//! What a registry refresh did, for the signals sent when it finishes.
+struct RefreshReport
+{
+  QMultiMap<int, LanguageParser::Errors> parsingErrors;
+  QString error;
+  bool updated = false;
+};
+
+//! A registry refresh that may still be running.
+struct RefreshFlight
+{
+  QFuture<BCP47Snapshot> future;
+  QSharedPointer<RefreshReport> report;
+};
+
+/*!
+  \brief The loads and refreshes shared by every BCP47Languages object.
+
+  The first object to ask for a load of a file, or a refresh of a registry,
+  starts it and any other object asking while it is running gets the same
+  future. Files that have been loaded are remembered with their modification
+  time so that they are not read again until they change.
+ */
+struct InFlight
+{
+  QMutex mutex;
+  QHash<QString, QFuture<BCP47Snapshot>> loads;
+  QHash<QString, QDateTime> loaded;
+  QHash<QString, RefreshFlight> refreshes;
+};
+
+InFlight&
+inFlight()
+{
+  static InFlight flights;
+  return flights;
+}
+
+//! The lock that guards the published snapshot.
+QReadWriteLock&
+publishedLock()
+{
+  static QReadWriteLock lock;
+  return lock;
+}
+
+//! The snapshot that every BCP47Languages object reads from.
+BCP47Snapshot&
+publishedSnapshot()
+{
+  static BCP47Snapshot snapshot;
+  return snapshot;
+}
+
+} // end of anonymous namespace
+
 const QVector<QString> BCP47Languages::TAGTYPES = QVector<QString>()
                                                   << "type"
                                                   << "tag"
@@ -289,51 +1220,28 @@ const QString BCP47Languages::IAINREGISTRY =
   "https://www.iana.org/assignments/language-subtag-registry/"
   "language-subtag-registry";
 
-QMultiMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_datasetByDescription =
-  QMultiMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_languageByDescription =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_languageBySubtag =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_extlangByDescription =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_extlangBySubtag =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_regionByDescription =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_regionBySubtag =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_scriptByDescription =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_scriptBySubtag =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_variantByDescription =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_variantBySubtag =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-// some grandfathered descriptions are NOT unique.
-QMultiMap<QString, QSharedPointer<BCP47Language>>BCP47Languages::m_grandfatheredByDescription =
-  QMultiMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_grandfatheredByTag =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_redundantByDescription =
-  QMap<QString, QSharedPointer<BCP47Language>>();
-QMap<QString, QSharedPointer<BCP47Language>> BCP47Languages::m_redundantByTag =
-  QMap<QString, QSharedPointer<BCP47Language>>();
 
 
 BCP47Languages::BCP47Languages(QObject* parent)
   : QObject(parent)
   , m_registryName(IAINREGISTRY)
-  , m_unStatistical(new UNStatisticalCodes())
+  , m_unStatistical(&UNStatisticalCodes::instance())
+{
+}
+
+BCP47Languages::~BCP47Languages()
 {
+  // the persist stage uses this object so it must finish first.
+  m_persist.waitForFinished();
 }
 
 void
 BCP47Languages::saveToLocalFile(const QString& filename)
 {
-  QFile file(filename);
-  if (file.open((QFile::ReadWrite | QFile::Truncate))) {
+  // the file is written beside the old one and renamed over it, so a watcher
+  // never reads it half written.
+  QSaveFile file(filename);
+  if (file.open(QIODevice::WriteOnly)) {
     // remove non-unique languages. (Those with multiple descriptions)
     QVector<QSharedPointer<BCP47Language>> uniqueLanguages =
       getUniqueLanguages();
@@ -352,6 +1260,8 @@ BCP47Languages::saveToLocalFile(const QString& filename)
       "the BCP47Languages::rebuildFromRegistry() method if the file becomes\n"
       "corrupted or outdated.\n\n"));
     emitter << YAML::BeginMap;
+    emitter << YAML::Key << "format-version" << YAML::Value
+            << YAML_FORMAT_VERSION;
     emitter << YAML::Key << "file-date" << YAML::Value
             << fileDate().toString(Qt::ISODate);
     emitter << YAML::Key << "languages" << YAML::Value;
@@ -419,150 +1329,15 @@ BCP47Languages::saveToLocalFile(const QString& filename)
       emitter << YAML::EndMap;
     }
     emitter << YAML::EndSeq;
+    // written last, so a reader can tell that the file is complete.
+    emitter << YAML::Key << "record-count" << YAML::Value
+            << int(uniqueLanguages.size());
     emitter << YAML::EndMap;
 
     QTextStream out(&file);
     out << emitter.c_str();
-    file.close();
-  }
-}
-
-void
-BCP47Languages::loadYamlFile(QFile& file)
-{
-  auto yaml = YAML::LoadFile(file);
-  if (yaml["file-date"]) {
-    auto node = yaml["file-date"];
-    m_fileDate = QDate::fromString(node.as<QString>(), Qt::ISODate);
-  }
-  if (yaml["languages"]) {
-    auto languagesNode = yaml["languages"];
-    if (languagesNode && languagesNode.IsSequence()) {
-      for (auto languageNode : languagesNode) {
-        if (languageNode && languageNode.IsMap()) {
-          auto language = QSharedPointer<BCP47Language>(new BCP47Language());
-          if (languageNode["type"]) {
-            auto value = languageNode["type"].as<QString>();
-            language->setType(BCP47Language::fromString(value));
-          }
-          if (languageNode["subtag"]) {
-            auto value = languageNode["subtag"].as<QString>();
-            language->setSubtag(value);
-          }
-          if (languageNode["tag"]) {
-            auto value = languageNode["tag"].as<QString>();
-            language->setTag(value);
-          }
-          if (languageNode["added"]) {
-            auto value = languageNode["added"].as<QString>();
-            language->setDateAdded(QDate::fromString(value, Qt::ISODate));
-          }
-          if (languageNode["suppress-script"]) {
-            auto value = languageNode["suppress-script"].as<QString>();
-            language->setSuppressScript(value);
-          }
-          if (languageNode["macrolanguage"]) {
-            auto value = languageNode["macrolanguage"].as<QString>();
-            language->setMacrolanguageName(value);
-          }
-          if (languageNode["preferred-value"]) {
-            auto value = languageNode["preferred-value"].as<QString>();
-            language->setPreferredValue(value);
-          }
-          if (languageNode["scope"]) {
-            auto value = languageNode["scope"].as<QString>();
-            if (value == "deprecated")
-              language->setDeprecated(true);
-            else if (value == "collection")
-              language->setCollection(true);
-            else if (value == "macrolanguage")
-              language->setMacrolanguage(true);
-          }
-          auto descriptions = languageNode["description"];
-          if (descriptions && descriptions.IsSequence()) {
-            for (auto const& description : descriptions) {
-              language->addDescription(description.as<QString>());
-            }
-          }
-          auto prefixes = languageNode["prefix"];
-          if (prefixes && prefixes.IsSequence()) {
-            for (auto const& prefix : prefixes) {
-              language->addPrefix(prefix.as<QString>());
-            }
-          }
-          auto comments = languageNode["comments"];
-          if (comments && comments.IsScalar()) {
-            language->setComments(comments.as<QString>());
-          }
-          // save language data (multi language description supported)
-          for (auto& description : language->descriptions()) {
-            addLanguage(description, language);
-          }
-        }
-      }
-    }
-  }
-  updateMaps();
-}
-
-void
-BCP47Languages::updateMaps()
-{
-  m_languageBySubtag.clear();
-  m_extlangBySubtag.clear();
-  m_regionBySubtag.clear();
-  m_scriptBySubtag.clear();
-  m_variantBySubtag.clear();
-  m_grandfatheredByTag.clear();
-  m_redundantByTag.clear();
-
-  auto uniqueDescriptions = m_datasetByDescription.uniqueKeys();
-  for (auto& description : uniqueDescriptions) {
-    auto languages = m_datasetByDescription.values(description);
-    for (auto& language : languages) {
-      auto subtag = language->subtag();
-      auto tag = language->tag();
-      auto type = language->type();
-      switch (type) {
-        case BCP47Language::LANGUAGE:
-          m_languageByDescription.insert(description, language);
-          m_languageBySubtag.insert(subtag, language);
-          //            m_datasetBySubtag.insert(subtag, language);
-          break;
-        case BCP47Language::EXTLANG:
-          m_extlangByDescription.insert(description, language);
-          m_extlangBySubtag.insert(subtag, language);
-          //          m_datasetBySubtag.insert(subtag, language);
-          break;
-        case BCP47Language::REGION:
-          m_regionByDescription.insert(description, language);
-          m_regionBySubtag.insert(subtag, language);
-          //          m_datasetBySubtag.insert(subtag, language);
-          break;
-        case BCP47Language::SCRIPT:
-          m_scriptByDescription.insert(description, language);
-          m_scriptBySubtag.insert(subtag, language);
-          //          m_datasetBySubtag.insert(subtag, language);
-          break;
-        case BCP47Language::VARIANT:
-          m_variantByDescription.insert(description, language);
-          m_variantBySubtag.insert(subtag, language);
-          //          m_datasetBySubtag.insert(subtag, language);
-          break;
-        case BCP47Language::GRANDFATHERED:
-          m_grandfatheredByDescription.insert(description, language);
-          m_grandfatheredByTag.insert(tag, language);
-          //          m_datasetBySubtag.insert(tag, language);
-          break;
-        case BCP47Language::REDUNDANT:
-          m_redundantByDescription.insert(description, language);
-          m_redundantByTag.insert(tag, language);
-          //          m_datasetBySubtag.insert(tag, language);
-          break;
-        default:
-          break;
-      }
-    }
+    out.flush();
+    file.commit();
   }
 }
 
@@ -598,9 +1373,10 @@ BCP47Languages::reloadData()
 void
 BCP47Languages::readFromLocalFile(const QString& filename)
 {
-  QFile file(filename);
-  if (file.exists()) {
-    loadYamlFile(file);
+  m_languageFilename = filename;
+  watchLocalFile();
+  if (QFile::exists(filename)) {
+    sharedLoad(filename).waitForFinished();
     emit completed();
   }
 
@@ -610,22 +1386,277 @@ BCP47Languages::readFromLocalFile(const QString& filename)
   rebuildFromRegistry();
 }
 
+QFuture<BCP47Snapshot>
+BCP47Languages::load(const QString& filename)
+{
+  m_languageFilename = filename;
+  watchLocalFile();
+  auto future = sharedLoad(filename);
+  auto watcher = new QFutureWatcher<BCP47Snapshot>(this);
+  connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher]() {
+    watcher->deleteLater();
+    emit completed();
+  });
+  watcher->setFuture(future);
+  return future;
+}
+
+QFuture<BCP47Snapshot>
+BCP47Languages::sharedLoad(const QString& filename)
+{
+  auto& flights = inFlight();
+  QMutexLocker locker(&flights.mutex);
+  auto running = flights.loads.value(filename);
+  if (running.isRunning())
+    return running;
+
+  auto future = QtConcurrent::run(pipelinePool(), [filename]() {
+    QFileInfo info(filename);
+    if (!info.exists())
+      return snapshot();
+    auto modified = info.lastModified();
+    {
+      // a file that has already been loaded is not read again.
+      QMutexLocker locker(&inFlight().mutex);
+      if (inFlight().loaded.value(filename) == modified)
+        return snapshot();
+    }
+    QFile file(filename);
+    try {
+      auto data = readYamlFile(file);
+      // a file still being written is not remembered, so the change that
+      // finishes it loads it again.
+      if (!data.complete || !data.fileDate.isValid() ||
+          data.languages.isEmpty())
+        return snapshot();
+      // a file with the same date may have been corrected, it replaces the
+      // snapshot if any record differs.
+      auto current = snapshot();
+      if (!(data.fileDate < current.fileDate())) {
+        auto updated =
+          BCP47Snapshot::update(current, data.languages, data.fileDate);
+        if (updated.d != current.d)
+          publish(updated, true);
+      }
+      QMutexLocker locker(&inFlight().mutex);
+      inFlight().loaded.insert(filename, modified);
+    } catch (const YAML::Exception&) {
+      // a damaged file is replaced by the next refresh.
+    }
+    return snapshot();
+  });
+  flights.loads.insert(filename, future);
+  return future;
+}
+
+void
+BCP47Languages::setWatchLocalFile(bool watch)
+{
+  if (watch == isWatchingLocalFile())
+    return;
+  if (!watch) {
+    delete m_watcher;
+    m_watcher = nullptr;
+    delete m_reloadTimer;
+    m_reloadTimer = nullptr;
+    return;
+  }
+
+  m_watcher = new QFileSystemWatcher(this);
+  // a writer may touch the file several times, so the changes are gathered
+  // up briefly and loaded once.
+  m_reloadTimer = new QTimer(this);
+  m_reloadTimer->setSingleShot(true);
+  m_reloadTimer->setInterval(250);
+  auto changed = [this]() { m_reloadTimer->start(); };
+  connect(m_watcher, &QFileSystemWatcher::fileChanged, this, changed);
+  connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, changed);
+  connect(m_reloadTimer,
+          &QTimer::timeout,
+          this,
+          &BCP47Languages::reloadLocalFile);
+  watchLocalFile();
+}
+
+bool
+BCP47Languages::isWatchingLocalFile() const
+{
+  return m_watcher != nullptr;
+}
+
+void
+BCP47Languages::watchLocalFile()
+{
+  if (!m_watcher || m_languageFilename.isEmpty())
+    return;
+
+  QFileInfo info(m_languageFilename);
+  auto directory = info.absolutePath();
+  auto directories = m_watcher->directories();
+  if (!directories.contains(directory)) {
+    if (!directories.isEmpty())
+      m_watcher->removePaths(directories);
+    m_watcher->addPath(directory);
+  }
+  // a file replaced by a rename drops out of the watcher, so it is added
+  // again whenever it exists.
+  auto file = info.absoluteFilePath();
+  auto files = m_watcher->files();
+  if (!files.contains(file)) {
+    if (!files.isEmpty())
+      m_watcher->removePaths(files);
+    if (info.exists())
+      m_watcher->addPath(file);
+  }
+}
+
+void
+BCP47Languages::reloadLocalFile()
+{
+  // a file being replaced is seen again through its directory.
+  if (!QFile::exists(m_languageFilename))
+    return;
+
+  auto previous = snapshot();
+  auto future = load(m_languageFilename);
+  auto watcher = new QFutureWatcher<BCP47Snapshot>(this);
+  connect(watcher,
+          &QFutureWatcherBase::finished,
+          this,
+          [this, watcher, previous]() {
+            auto current = watcher->result();
+            watcher->deleteLater();
+            if (current.d == previous.d)
+              return;
+            emit languagesReset();
+            emit sendMessage(tr("Language file reloaded %1")
+                               .arg(current.fileDate().toString(Qt::ISODate)));
+          });
+  watcher->setFuture(future);
+}
+
+void
+BCP47Languages::setRegistryDownloader(RegistryDownloader downloader)
+{
+  QMutexLocker locker(&registryDownloader().mutex);
+  registryDownloader().download = downloader;
+}
+
 void
 BCP47Languages::rebuildFromRegistry()
 {
-  QThread* thread = new QThread;
-  auto worker = new FileDownloader();
-  worker->setDownloadUrl(m_registryName);
-  worker->moveToThread(thread);
-  connect(worker, &FileDownloader::error, this, &BCP47Languages::errorReceived);
-  connect(
-    worker, &FileDownloader::dataDownloaded, this, &BCP47Languages::parseData);
-  connect(thread, &QThread::started, worker, &FileDownloader::download);
-  connect(worker, &FileDownloader::finished, thread, &QThread::quit);
-  connect(
-    worker, &FileDownloader::finished, worker, &FileDownloader::deleteLater);
-  connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-  thread->start();
+  refresh();
+}
+
+QFuture<BCP47Snapshot>
+BCP47Languages::refresh()
+{
+  // this object is already waiting for a refresh.
+  if (m_refresh.isRunning())
+    return m_refresh;
+
+  // a refresh of the same registry started by any other object is shared, only
+  // the object that started it saves the local file.
+  auto url = m_registryName;
+  auto& flights = inFlight();
+  QMutexLocker locker(&flights.mutex);
+  auto flight = flights.refreshes.value(url);
+  auto leader = !flight.future.isRunning();
+  if (leader) {
+    auto report = QSharedPointer<RefreshReport>::create();
+    // the download, parse and index stages run on the shared pool.
+    flight.report = report;
+    QMutexLocker downloaderLocker(&registryDownloader().mutex);
+    auto download = registryDownloader().download;
+    downloaderLocker.unlock();
+    flight.future =
+      QtConcurrent::run(pipelinePool(), [url, report, download]() {
+        if (!download)
+          return snapshot();
+        auto data = download(url, report->error);
+        if (report->error.isEmpty() && data.isEmpty())
+          report->error = tr("The registry file was empty!");
+        if (!report->error.isEmpty())
+          return snapshot();
+
+        auto parsed = parseRegistry(data);
+        report->parsingErrors = parsed.parsingErrors;
+        if (!(snapshot().fileDate() < parsed.fileDate))
+          return snapshot();
+        if (!parsed.parsingErrors.isEmpty()) {
+          report->error = tr("The registry file had errors!");
+          return snapshot();
+        }
+        report->updated = publish(
+          BCP47Snapshot::update(snapshot(), parsed.languages, parsed.fileDate));
+        return snapshot();
+      });
+    flights.refreshes.insert(url, flight);
+  }
+  locker.unlock();
+
+  // the signals are sent from here and the persist stage goes back to the
+  // pool.
+  auto report = flight.report;
+  m_refresh = flight.future;
+  auto watcher = new QFutureWatcher<BCP47Snapshot>(this);
+  connect(watcher,
+          &QFutureWatcherBase::finished,
+          this,
+          [this, watcher, report, leader]() {
+            auto current = watcher->result();
+            watcher->deleteLater();
+            parsingErrorsReceived(report->parsingErrors);
+            if (!report->error.isEmpty())
+              errorReceived(report->error);
+            if (!report->updated)
+              return;
+            emit languagesReset();
+            emit sendMessage(tr("Language file updated %1")
+                               .arg(current.fileDate().toString(Qt::ISODate)));
+            if (leader && !m_languageFilename.isEmpty() &&
+                !m_persist.isRunning()) {
+              // the persist stage.
+              auto filename = m_languageFilename;
+              m_persist = QtConcurrent::run(pipelinePool(), [this, filename]() {
+                saveToLocalFile(filename);
+                // the saved file holds the published data, so a watcher
+                // does not need to load it back.
+                QMutexLocker locker(&inFlight().mutex);
+                inFlight().loaded.insert(filename,
+                                         QFileInfo(filename).lastModified());
+              });
+            }
+          });
+  watcher->setFuture(m_refresh);
+  return m_refresh;
+}
+
+BCP47Snapshot
+BCP47Languages::snapshot()
+{
+  QReadLocker locker(&publishedLock());
+  return publishedSnapshot();
+}
+
+bool
+BCP47Languages::publish(const BCP47Snapshot& snapshot, bool replaceSameDate)
+{
+  {
+    QWriteLocker locker(&publishedLock());
+    auto& published = publishedSnapshot();
+    // an older registry never replaces a newer one.
+    if (!published.isEmpty() && snapshot.fileDate() < published.fileDate())
+      return false;
+    if (!published.isEmpty() && !replaceSameDate &&
+        !(published.fileDate() < snapshot.fileDate()))
+      return false;
+    published = snapshot;
+  }
+  // the cached lists and names were built from the old data.
+  sortedDescriptionLists().clear();
+  displayNameCache().clear();
+  return true;
 }
 
 void
@@ -647,9 +1678,11 @@ BCP47Languages::parsingErrorsReceived(
   // TODO parse errors and send message
   QString message;
   if (!errors.isEmpty()) {
-    auto keys = errors.keys();
-    for (auto& line : keys) {
-      auto error = errors.value(line);
+    // keys() repeats a line for each of its errors, and value() would then
+    // return the same error each time, so the map is walked directly.
+    for (auto it = errors.constBegin(); it != errors.constEnd(); ++it) {
+      auto line = it.key();
+      auto error = it.value();
       if (error.testFlag(LanguageParser::NO_ERROR)) {
         // This should never happen, but just in case
         message.append(tr("No Errors"));
@@ -691,78 +1724,174 @@ BCP47Languages::parsingErrorsReceived(
   }
 }
 
-void
-BCP47Languages::parseData(const QByteArray& data)
-{
-  QThread* thread = new QThread;
-  worker = new LanguageParser();
-  worker->setData(data);
-  worker->moveToThread(thread);
-  connect(worker,
-          &LanguageParser::parsingErrors,
-          this,
-          &BCP47Languages::parsingErrorsReceived);
-  connect(worker,
-          &LanguageParser::parseCompleted,
-          this,
-          &BCP47Languages::iainFileParsed);
-  connect(thread, &QThread::started, worker, &LanguageParser::parse);
-  connect(worker, &LanguageParser::finished, thread, &QThread::quit);
-  connect(
-    worker, &LanguageParser::finished, worker, &LanguageParser::deleteLater);
-  connect(thread, &QThread::finished, thread, &QThread::deleteLater);
-  thread->start();
-}
-
 QVector<QSharedPointer<BCP47Language>>
 BCP47Languages::getUniqueLanguages()
 {
+  // a record is in the dataset once for each of its descriptions, a set of
+  // those already seen keeps this linear rather than searching the vector.
+  auto dataset = snapshot().dataset();
   QVector<QSharedPointer<BCP47Language>> uniqueLanguages;
-  for (auto& language : m_datasetByDescription.values()) {
-    if (!uniqueLanguages.contains(language)) {
+  uniqueLanguages.reserve(dataset.size());
+  QSet<const BCP47Language*> seen;
+  seen.reserve(dataset.size());
+  for (auto& language : dataset) {
+    if (!seen.contains(language.data())) {
+      seen.insert(language.data());
       uniqueLanguages.append(language);
     }
   }
   return uniqueLanguages;
 }
 
-void
-BCP47Languages::iainFileParsed(
-  QMultiMap<QString, QSharedPointer<BCP47Language>> languages,
-  QDate fileDate,
-  bool noErrors)
-{
-  if (m_fileDate < fileDate) {
-    if (noErrors) {
-      m_fileDate = fileDate;
-      m_datasetByDescription = languages;
-      saveToLocalFile(m_languageFilename);
-      emit sendMessage(
-        tr("Language file updated %1").arg(m_fileDate.toString(Qt::ISODate)));
-    } else {
-      emit error(tr("The registry file had errors!"));
-    }
-  }
-}
-
 QVector<QString>
 BCP47Languages::scriptDescriptions() const
 {
-  return m_scriptByDescription.keys();
+  auto d = snapshot().d;
+  return d->scriptByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::scriptSubtags() const
 {
-  return m_scriptBySubtag.keys();
+  auto d = snapshot().d;
+  return d->scriptBySubtag.keys();
+}
+
+QVector<QString>
+BCP47Languages::sortedDescriptions(BCP47Language::Type type,
+                                   const QLocale& locale) const
+{
+  return sortedDescriptionLists().sorted(
+    type, locale, [type]() { return snapshot().descriptions(type); });
+}
+
+QString
+BCP47Languages::displayName(const QString& tag,
+                            UNStatisticalCodes::Language displayLanguage) const
+{
+  auto& cache = displayNameCache();
+  auto key = qMakePair(tag, int(displayLanguage));
+  QString name;
+  if (cache.find(key, name))
+    return name;
+  // read the generation first, a publish in between then stops the insert.
+  auto generation = cache.generation();
+  name = displayName(snapshot(), tag, displayLanguage);
+  if (!name.isEmpty())
+    cache.insert(key, name, generation);
+  return name;
+}
+
+QString
+BCP47Languages::displayName(const BCP47Snapshot& snapshot,
+                            const QString& tag,
+                            UNStatisticalCodes::Language displayLanguage) const
+{
+  auto d = snapshot.d;
+  QString name;
+  auto whole = d->grandfatheredByTag.value(tag);
+  if (!whole)
+    whole = d->redundantByTag.value(tag);
+  if (whole) {
+    name = whole->description();
+  } else {
+    auto subtags = tag.split('-');
+    auto language = d->languageBySubtag.value(subtags.at(0).toLower());
+    if (!language)
+      return QString();
+    name = language->description();
+
+    QStringList details;
+    for (int i = 1; i < subtags.size(); i++) {
+      auto subtag = subtags.at(i);
+      if (subtag.size() == 1)
+        break; // extensions and private use are not described.
+
+      if (i == 1 && subtag.size() == 3 && subtag.at(0).isLetter()) {
+        auto extlang = d->extlangBySubtag.value(subtag.toLower());
+        if (extlang)
+          name = extlang->description();
+      } else if (subtag.size() == 4 && subtag.at(0).isLetter()) {
+        auto script = d->scriptBySubtag.value(subtag.at(0).toUpper() +
+                                             subtag.mid(1).toLower());
+        if (script)
+          details.append(script->description());
+      } else if (subtag.size() == 2 ||
+                 (subtag.size() == 3 && subtag.at(0).isDigit())) {
+        auto upper = subtag.toUpper();
+        auto region = d->regionBySubtag.value(upper);
+        if (region) {
+          auto unName = displayLanguage == UNStatisticalCodes::English
+                          ? QString()
+                          : m_unStatistical->name(
+                              displayLanguage,
+                              d->m49ByRegionSubtag.value(upper, -1));
+          details.append(unName.isEmpty() ? region->description() : unName);
+        }
+      } else {
+        auto variant = d->variantBySubtag.value(subtag.toLower());
+        if (variant)
+          details.append(variant->description());
+      }
+    }
+    if (!details.isEmpty())
+      name += QStringLiteral(" (") + details.join(QStringLiteral(", ")) +
+              QStringLiteral(")");
+  }
+  return name;
+}
+
+QString
+BCP47Languages::canonicalTag(const QString& tag) const
+{
+  return canonicalTag(snapshot(), tag);
+}
+
+QString
+BCP47Languages::canonicalTag(const BCP47Snapshot& snapshot,
+                             const QString& tag) const
+{
+  auto trimmed = tag.trimmed();
+  // tags are ASCII, so they are copied to the stack rather than converted.
+  char input[MAX_STACK_TAG];
+  std::string_view value;
+  QByteArray utf8;
+  if (!asciiKey(trimmed, input, value)) {
+    utf8 = trimmed.toUtf8();
+    value = std::string_view(utf8.constData(), std::size_t(utf8.size()));
+  }
+  char buffer[MAX_STACK_TAG];
+  auto length = snapshot.core().canonicalise(value, buffer, sizeof(buffer));
+  if (length <= sizeof(buffer)) {
+    // a tag that is already canonical is shared rather than copied.
+    if (std::string_view(buffer, length) == value)
+      return trimmed;
+    return QString::fromUtf8(buffer, int(length));
+  }
+  QByteArray canonical(int(length), '\0');
+  snapshot.core().canonicalise(value, canonical.data(), length);
+  return QString::fromUtf8(canonical);
+}
+
+bool
+BCP47Languages::isValidTag(const QString& tag) const
+{
+  char buffer[MAX_STACK_TAG];
+  std::string_view value;
+  if (asciiKey(tag, buffer, value))
+    return snapshot().core().isValid(value);
+  auto utf8 = tag.toUtf8();
+  return snapshot().core().isValid(
+    std::string_view(utf8.constData(), std::size_t(utf8.size())));
 }
 
 QString
 BCP47Languages::scriptTag(const QString& languageName,
                           const QString& scriptName)
 {
-  auto tags = m_languageBySubtag.value(languageName);
-  auto scriptTag = m_scriptBySubtag.value(scriptName);
+  auto d = snapshot().d;
+  auto tags = d->languageBySubtag.value(languageName);
+  auto scriptTag = d->scriptBySubtag.value(scriptName);
   if (!tags.isNull() || !scriptTag.isNull())
     return tags->prefix().at(0) + "-" + scriptTag->subtag() + "-" +
            tags->subtag();
@@ -772,12 +1901,13 @@ BCP47Languages::scriptTag(const QString& languageName,
 QString
 BCP47Languages::variantTag(const QString& scriptName, const QString& region)
 {
-  auto tags = m_variantBySubtag.value(scriptName);
+  auto d = snapshot().d;
+  auto tags = d->variantBySubtag.value(scriptName);
   if (region.isEmpty()) {
     if (!tags.isNull())
       return tags->prefix().at(0) + "-" + tags->subtag();
   } else {
-    auto regTag = m_regionBySubtag.value(region);
+    auto regTag = d->regionBySubtag.value(region);
     if (!tags.isNull() || !regTag.isNull())
       return tags->prefix().at(0) + "-" + regTag->subtag() + "-" +
              tags->subtag();
@@ -788,13 +1918,15 @@ BCP47Languages::variantTag(const QString& scriptName, const QString& region)
 QVector<QString>
 BCP47Languages::grandfatheredDescriptions() const
 {
-  return m_grandfatheredByDescription.keys();
+  auto d = snapshot().d;
+  return d->grandfatheredByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::grandfatheredTags() const
 {
-  return m_grandfatheredByTag.keys();
+  auto d = snapshot().d;
+  return d->grandfatheredByTag.keys();
 }
 
 bool
@@ -828,6 +1960,12 @@ BCP47Languages::typeFromString(const QString& value)
 
 QVector<QSharedPointer<BCP47Language::TagTestResult>>
 BCP47Languages::testTag(QString& tag)
+{
+  return testTag(snapshot(), tag);
+}
+
+QVector<QSharedPointer<BCP47Language::TagTestResult>>
+BCP47Languages::testTag(const BCP47Snapshot& snapshot, QString& tag)
 {
   QVector<QSharedPointer<BCP47Language::TagTestResult>> results;
   QSharedPointer<BCP47Language::TagTestResult> result;
@@ -850,7 +1988,7 @@ BCP47Languages::testTag(QString& tag)
     }
 
     if (c == '-' || pos == testValue.length()) {
-      auto type = checkPrimaryLanguage(subvalue);
+      auto type = checkPrimaryLanguage(snapshot, subvalue);
       if (type != BCP47Language::NO_PRIMARY_LANGUAGE) {
         result->type = type;
         result->text = subvalue;
@@ -860,7 +1998,7 @@ BCP47Languages::testTag(QString& tag)
         continue;
       }
 
-      type = checkExtendedlanguage(subvalue);
+      type = checkExtendedlanguage(snapshot, subvalue);
       if (type != BCP47Language::NO_EXTENDED_LANGUAGE) {
         result->type = type;
         result->text = subvalue;
@@ -870,7 +2008,7 @@ BCP47Languages::testTag(QString& tag)
         continue;
       }
 
-      type = checkScript(subvalue);
+      type = checkScript(snapshot, subvalue);
       if (type != BCP47Language::NO_SCRIPT) {
         result->type = type;
         result->text = subvalue;
@@ -880,7 +2018,7 @@ BCP47Languages::testTag(QString& tag)
         continue;
       }
 
-      type = checkRegion(subvalue);
+      type = checkRegion(snapshot, subvalue);
       if (type != BCP47Language::NO_REGION) {
         result->type = type;
         result->text = subvalue;
@@ -907,10 +2045,17 @@ BCP47Languages::testTag(QString& tag)
 
 BCP47Language::TagType
 BCP47Languages::checkPrimaryLanguage(const QString& value)
+{
+  return checkPrimaryLanguage(snapshot(), value);
+}
+
+BCP47Language::TagType
+BCP47Languages::checkPrimaryLanguage(const BCP47Snapshot& snapshot,
+                                     const QString& value) const
 {
   if (value == "i" || value == "x" || (value >= "qaa" && value <= "qtz"))
     return BCP47Language::PRIVATE_LANGUAGE;
-  else if (isPrimaryLanguage(value))
+  else if (containsSubtag(snapshot, BCP47Core::Language, value))
     return BCP47Language::PRIMARY_LANGUAGE;
   return BCP47Language::NO_PRIMARY_LANGUAGE;
 }
@@ -918,7 +2063,14 @@ BCP47Languages::checkPrimaryLanguage(const QString& value)
 BCP47Language::TagType
 BCP47Languages::checkExtendedlanguage(const QString& value)
 {
-  if (isExtLang(value)) {
+  return checkExtendedlanguage(snapshot(), value);
+}
+
+BCP47Language::TagType
+BCP47Languages::checkExtendedlanguage(const BCP47Snapshot& snapshot,
+                                      const QString& value) const
+{
+  if (containsSubtag(snapshot, BCP47Core::Extlang, value)) {
     return BCP47Language::EXTENDED_LANGUAGE;
   }
   return BCP47Language::NO_EXTENDED_LANGUAGE;
@@ -927,7 +2079,14 @@ BCP47Languages::checkExtendedlanguage(const QString& value)
 BCP47Language::TagType
 BCP47Languages::checkScript(const QString& value)
 {
-  if (isScript(value)) {
+  return checkScript(snapshot(), value);
+}
+
+BCP47Language::TagType
+BCP47Languages::checkScript(const BCP47Snapshot& snapshot,
+                            const QString& value) const
+{
+  if (containsSubtag(snapshot, BCP47Core::Script, value)) {
     return BCP47Language::SCRIPT_LANGUAGE;
   } else if (value >= "Qaaa" && value <= "Qabx") {
     return BCP47Language::PRIVATE_SCRIPT;
@@ -938,7 +2097,17 @@ BCP47Languages::checkScript(const QString& value)
 BCP47Language::TagType
 BCP47Languages::checkRegion(const QString& value)
 {
-  if (isRegion(value)) {
+  return checkRegion(snapshot(), value);
+}
+
+BCP47Language::TagType
+BCP47Languages::checkRegion(const BCP47Snapshot& snapshot,
+                            const QString& value) const
+{
+  if (containsSubtag(snapshot, BCP47Core::Region, value)) {
+    if (m_unStatistical->isRegion(
+          snapshot.d->m49ByRegionSubtag.value(value, -1)))
+      return BCP47Language::UN_STATISTICAL_REGION;
     return BCP47Language::REGIONAL_LANGUAGE;
   } else if (value == "AA" || (value >= "QM" && value <= "QZ") ||
              (value >= "XA" && value <= "XZ") || value == "ZZ") {
@@ -977,153 +2146,198 @@ BCP47Languages::checkRedundant(const QString& value)
 bool
 BCP47Languages::isPrimaryLanguage(const QString& subtag)
 {
-  auto keys = m_languageBySubtag.keys();
-  return keys.contains(subtag);
+  return containsSubtag(BCP47Core::Language, subtag);
 }
 
 bool
 BCP47Languages::isExtLang(const QString& subtag)
 {
-  auto keys = m_extlangBySubtag.keys();
-  return keys.contains(subtag);
+  return containsSubtag(BCP47Core::Extlang, subtag);
 }
 
 bool
 BCP47Languages::isVariant(const QString& subtag)
 {
-  auto keys = m_variantBySubtag.keys();
-  return keys.contains(subtag);
+  return containsSubtag(BCP47Core::Variant, subtag);
 }
 
 bool
 BCP47Languages::isRegion(const QString& subtag)
 {
-  auto keys = m_regionBySubtag.keys();
-  return keys.contains(subtag);
+  return containsSubtag(BCP47Core::Region, subtag);
+}
+
+bool
+BCP47Languages::regionContains(const QString& region, const QString& subtag)
+{
+  if (!isRegion(region) || !isRegion(subtag))
+    return false;
+  if (region == subtag)
+    return true;
+  return m_unStatistical->regionContains(m49ForRegion(region),
+                                         m49ForRegion(subtag));
+}
+
+int
+BCP47Languages::m49ForRegion(const QString& subtag) const
+{
+  auto d = snapshot().d;
+  return d->m49ByRegionSubtag.value(subtag, -1);
+}
+
+QString
+BCP47Languages::alpha3ForRegion(const QString& subtag) const
+{
+  auto m49 = m49ForRegion(subtag);
+  if (m49 < 0)
+    return QString();
+  return m_unStatistical->alphaCode(m49);
+}
+
+QString
+BCP47Languages::regionForM49(int m49) const
+{
+  auto d = snapshot().d;
+  if (m49 < 0 || m49 >= d->regionSubtagByM49.size())
+    return QString();
+  return d->regionSubtagByM49.at(m49);
 }
 
 bool
 BCP47Languages::isScript(const QString& subtag)
 {
-  auto keys = m_scriptBySubtag.keys();
-  return keys.contains(subtag);
+  return containsSubtag(BCP47Core::Script, subtag);
 }
 
 bool
 BCP47Languages::isGrandfathered(const QString& subtag)
 {
-  auto keys = m_grandfatheredByTag.keys();
-  return keys.contains(subtag);
+  return containsSubtag(BCP47Core::Grandfathered, subtag);
 }
 
 bool
 BCP47Languages::isRedundant(const QString& subtag)
 {
-  auto keys = m_redundantByTag.keys();
-  return keys.contains(subtag);
+  return containsSubtag(BCP47Core::Redundant, subtag);
 }
 
 QDate
 BCP47Languages::fileDate() const
 {
-  return m_fileDate;
+  return snapshot().fileDate();
 }
 
 QVector<QSharedPointer<BCP47Language>>
 BCP47Languages::fromDescription(const QString& description)
 {
-  return m_datasetByDescription.values(description);
+  auto d = snapshot().d;
+  return d->datasetByDescription.values(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::languageFromDescription(const QString& description)
 {
-  return m_languageByDescription.value(description);
+  auto d = snapshot().d;
+  return d->languageByDescription.value(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::extlangFromDescription(const QString& description)
 {
-  return m_extlangByDescription.value(description);
+  auto d = snapshot().d;
+  return d->extlangByDescription.value(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::variantFromDescription(const QString& description)
 {
-  return m_variantByDescription.value(description);
+  auto d = snapshot().d;
+  return d->variantByDescription.value(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::regionFromDescription(const QString& description)
 {
-  return m_regionByDescription.value(description);
+  auto d = snapshot().d;
+  return d->regionByDescription.value(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::scriptFromDescription(const QString& description)
 {
-  return m_scriptByDescription.value(description);
+  auto d = snapshot().d;
+  return d->scriptByDescription.value(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::redundantFromDescription(const QString& description)
 {
-  return m_redundantByDescription.value(description);
+  auto d = snapshot().d;
+  return d->redundantByDescription.value(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::grandfatheredFromDescription(const QString& description)
 {
-  return m_grandfatheredByDescription.value(description);
+  auto d = snapshot().d;
+  return d->grandfatheredByDescription.value(description);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::languageFromSubtag(const QString& subtag)
 {
-  return m_languageBySubtag.value(subtag);
+  auto d = snapshot().d;
+  return d->languageBySubtag.value(subtag);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::extlangFromSubtag(const QString& subtag)
 {
-  return m_extlangBySubtag.value(subtag);
+  auto d = snapshot().d;
+  return d->extlangBySubtag.value(subtag);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::variantFromSubtag(const QString& subtag)
 {
-  return m_variantBySubtag.value(subtag);
+  auto d = snapshot().d;
+  return d->variantBySubtag.value(subtag);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::regionFromSubtag(const QString& subtag)
 {
-  return m_regionBySubtag.value(subtag);
+  auto d = snapshot().d;
+  return d->regionBySubtag.value(subtag);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::scriptFromSubtag(const QString& subtag)
 {
-  return m_scriptBySubtag.value(subtag);
+  auto d = snapshot().d;
+  return d->scriptBySubtag.value(subtag);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::redundantFromTag(const QString& tag)
 {
-  return m_redundantByTag.value(tag);
+  auto d = snapshot().d;
+  return d->redundantByTag.value(tag);
 }
 
 QSharedPointer<BCP47Language>
 BCP47Languages::grandfatheredFromTag(const QString& tag)
 {
-  return m_grandfatheredByTag.value(tag);
+  auto d = snapshot().d;
+  return d->grandfatheredByTag.value(tag);
 }
 
 QVector<QString>
 BCP47Languages::extlangsWithPrefix(const QString subtag)
 {
+  auto d = snapshot().d;
   QVector<QString> list;
-  auto values = m_extlangBySubtag.values();
+  auto values = d->extlangBySubtag.values();
   for (auto& extlang : values) {
     if (extlang && extlang->prefix().contains(subtag)) {
       list << extlang->description();
@@ -1135,8 +2349,9 @@ BCP47Languages::extlangsWithPrefix(const QString subtag)
 QVector<QString>
 BCP47Languages::variantsWithPrefix(const QString subtag)
 {
+  auto d = snapshot().d;
   QVector<QString> list;
-  auto values = m_variantBySubtag.values();
+  auto values = d->variantBySubtag.values();
   for (auto& variant : values) {
     if (variant && variant->prefix().contains(subtag)) {
       list << variant->description();
@@ -1148,67 +2363,77 @@ BCP47Languages::variantsWithPrefix(const QString subtag)
 QVector<QString>
 BCP47Languages::descriptions() const
 {
-  return m_datasetByDescription.keys();
+  auto d = snapshot().d;
+  return d->datasetByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::languageDescriptions() const
 {
-  return m_languageByDescription.keys();
+  auto d = snapshot().d;
+  return d->languageByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::languageSubtags() const
 {
-  return m_languageBySubtag.keys();
+  auto d = snapshot().d;
+  return d->languageBySubtag.keys();
 }
 
 QVector<QString>
 BCP47Languages::regionDescriptions() const
 {
-  return m_regionByDescription.keys();
+  auto d = snapshot().d;
+  return d->regionByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::regionSubtags() const
 {
-  return m_regionBySubtag.keys();
+  auto d = snapshot().d;
+  return d->regionBySubtag.keys();
 }
 
 QVector<QString>
 BCP47Languages::variantDescriptions() const
 {
-  return m_variantByDescription.keys();
+  auto d = snapshot().d;
+  return d->variantByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::variantSubtags() const
 {
-  return m_variantBySubtag.keys();
+  auto d = snapshot().d;
+  return d->variantBySubtag.keys();
 }
 
 QVector<QString>
 BCP47Languages::redundantDescriptions() const
 {
-  return m_redundantByDescription.keys();
+  auto d = snapshot().d;
+  return d->redundantByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::redundantTags() const
 {
-  return m_redundantByTag.keys();
+  auto d = snapshot().d;
+  return d->redundantByTag.keys();
 }
 
 QString
 BCP47Languages::languageTag(const QString& languageName,
                             const QString& regionName)
 {
-  auto tag = m_languageBySubtag.value(languageName);
+  auto d = snapshot().d;
+  auto tag = d->languageBySubtag.value(languageName);
   if (regionName.isEmpty()) {
     if (!tag.isNull())
       return tag->subtag();
   } else {
-    auto regTag = m_regionBySubtag.value(regionName);
+    auto regTag = d->regionBySubtag.value(regionName);
     if (!tag.isNull() && !regTag.isNull()) {
       return tag->subtag() + "-" + regTag->subtag();
     }
@@ -1219,35 +2444,31 @@ BCP47Languages::languageTag(const QString& languageName,
 QMultiMap<QString, QSharedPointer<BCP47Language>>
 BCP47Languages::dataset()
 {
-  return m_datasetByDescription;
+  return snapshot().dataset();
 }
 
 QVector<QString>
 BCP47Languages::extlangDescriptions() const
 {
-  return m_extlangByDescription.keys();
+  auto d = snapshot().d;
+  return d->extlangByDescription.keys();
 }
 
 QVector<QString>
 BCP47Languages::extlangSubtags() const
 {
-  return m_extlangBySubtag.keys();
+  auto d = snapshot().d;
+  return d->extlangBySubtag.keys();
 }
 
 QString
 BCP47Languages::extLangTag(const QString& extlanName)
 {
-  auto langTag = m_languageBySubtag.value(extlanName);
+  auto d = snapshot().d;
+  auto langTag = d->languageBySubtag.value(extlanName);
   return langTag->prefix().at(0) + "-" + langTag->preferredValue();
 }
 
-void
-BCP47Languages::addLanguage(const QString& description,
-                            QSharedPointer<BCP47Language> language)
-{
-  m_datasetByDescription.insert(description, language);
-}
-
 //====================================================================
 //=== LanguageParser
 //====================================================================
@@ -0,0 +1,52 @@
+#include "language/network.h"
+#include "language/languages.h"
+
+#include <QCoreApplication>
+#include <QEventLoop>
+
+#include "utilities/filedownloader.h"
+
+QByteArray
+BCP47Network::download(const QString& url, QString& errorStr)
+{
+  QByteArray data;
+  bool finished = false;
+  QEventLoop loop;
+  FileDownloader downloader;
+  downloader.setDownloadUrl(url);
+  QObject::connect(
+    &downloader,
+    &FileDownloader::dataDownloaded,
+    [&data](const QByteArray& downloaded) { data = downloaded; });
+  QObject::connect(
+    &downloader, &FileDownloader::error, [&errorStr](const QString& message) {
+      errorStr = message;
+    });
+  QObject::connect(&downloader, &FileDownloader::finished, [&]() {
+    finished = true;
+    loop.quit();
+  });
+  downloader.download();
+  if (!finished)
+    loop.exec();
+  return data;
+}
+
+void
+BCP47Network::install()
+{
+  BCP47Languages::setRegistryDownloader(&BCP47Network::download);
+}
+
+namespace {
+
+// the macro needs an unqualified function name.
+void
+installDownloader()
+{
+  BCP47Network::install();
+}
+
+} // end of anonymous namespace
+
+Q_COREAPP_STARTUP_FUNCTION(installDownloader)
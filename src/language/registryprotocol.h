@@ -0,0 +1,91 @@
+#ifndef REGISTRYPROTOCOL_H
+#define REGISTRYPROTOCOL_H
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QIODevice>
+#include <QtGlobal>
+
+/// \cond DO_NOT_DOCUMENT
+/*!
+  \file registryprotocol.h
+  \brief The binary protocol between BCP47RegistryClient and
+  BCP47RegistryServer.
+
+  Every message is a single QByteArray written with QDataStream, so it is
+  preceded by its length and can be read with a QDataStream transaction once
+  it has fully arrived.
+
+  A request holds a header followed by a batch of queries:
+  - quint32 MAGIC, quint16 VERSION, quint32 query count.
+  - for each query, quint8 operation, quint8 BCP47Language::Type and the
+    QString value.
+
+  A reply holds a header followed by one answer for each query, in order:
+  - quint32 MAGIC, quint16 VERSION, QDate registry file date, quint32 answer
+    count.
+  - for each answer, quint8 found, quint32 flags, the QString value and the
+    QVector<QString> values.
+
+  A request with the wrong magic number or version is answered with an empty
+  batch and the connection is closed.
+ */
+namespace RegistryProtocol {
+
+const quint32 MAGIC = 0x42435034; // "BCP4"
+const quint16 VERSION = 1;
+//! The largest batch a server will answer.
+const quint32 MAX_BATCH = 65536;
+//! The largest message either end will accept.
+const quint32 MAX_MESSAGE = 16 * 1024 * 1024;
+
+//! Sets the QDataStream format used by the protocol on stream.
+inline QDataStream&
+setup(QDataStream& stream)
+{
+  stream.setVersion(QDataStream::Qt_5_12);
+  return stream;
+}
+
+/*!
+  \brief Reads the next whole message from device into message.
+
+  Returns false, leaving the data in device, if the message has not fully
+  arrived yet. A message larger than MAX_MESSAGE sets error to true.
+ */
+inline bool
+readMessage(QIODevice* device, QByteArray& message, bool& error)
+{
+  error = false;
+  // check the length before QDataStream allocates the array.
+  QDataStream peek(device->peek(sizeof(quint32)));
+  setup(peek);
+  quint32 length = 0;
+  peek >> length;
+  if (peek.status() != QDataStream::Ok)
+    return false;
+  if (length != 0xFFFFFFFF && length > MAX_MESSAGE) {
+    error = true;
+    return false;
+  }
+
+  QDataStream stream(device);
+  setup(stream);
+  stream.startTransaction();
+  stream >> message;
+  return stream.commitTransaction();
+}
+
+//! Writes message to device as a single length prefixed QByteArray.
+inline void
+writeMessage(QIODevice* device, const QByteArray& message)
+{
+  QDataStream stream(device);
+  setup(stream);
+  stream << message;
+}
+
+} // end of namespace RegistryProtocol
+/// \endcond DO_NOT_DOCUMENT
+
+#endif // REGISTRYPROTOCOL_H
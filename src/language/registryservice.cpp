@@ -0,0 +1,345 @@
+#include "language/registryservice.h"
+#include "language/registryprotocol.h"
+
+#include <QElapsedTimer>
+#include <QLocalServer>
+#include <QLocalSocket>
+
+//====================================================================
+//=== BCP47RegistryServer
+//====================================================================
+BCP47RegistryServer::BCP47RegistryServer(BCP47Languages* languages,
+                                         QObject* parent)
+  : QObject(parent)
+  , m_languages(languages)
+  , m_server(new QLocalServer(this))
+{
+  m_server->setSocketOptions(QLocalServer::UserAccessOption);
+  connect(m_server,
+          &QLocalServer::newConnection,
+          this,
+          &BCP47RegistryServer::clientConnected);
+}
+
+BCP47RegistryServer::~BCP47RegistryServer()
+{
+  close();
+}
+
+bool
+BCP47RegistryServer::listen(const QString& name)
+{
+  if (m_server->listen(name))
+    return true;
+
+  if (m_server->serverError() == QAbstractSocket::AddressInUseError) {
+    // only remove the socket if no server answers on it.
+    QLocalSocket probe;
+    probe.connectToServer(name);
+    if (!probe.waitForConnected(500)) {
+      QLocalServer::removeServer(name);
+      if (m_server->listen(name))
+        return true;
+    }
+  }
+
+  emit error(tr("Unable to listen on %1 : %2")
+               .arg(name, m_server->errorString()));
+  return false;
+}
+
+void
+BCP47RegistryServer::close()
+{
+  m_server->close();
+  for (auto socket : m_server->findChildren<QLocalSocket*>())
+    socket->abort();
+}
+
+bool
+BCP47RegistryServer::isListening() const
+{
+  return m_server->isListening();
+}
+
+QString
+BCP47RegistryServer::defaultName()
+{
+  auto user = qEnvironmentVariable("USER");
+  if (user.isEmpty())
+    user = qEnvironmentVariable("USERNAME");
+  return QStringLiteral("bcp47-registry-") + user;
+}
+
+void
+BCP47RegistryServer::clientConnected()
+{
+  while (m_server->hasPendingConnections()) {
+    auto socket = m_server->nextPendingConnection();
+    connect(socket, &QLocalSocket::readyRead, this, [this, socket]() {
+      readRequests(socket);
+    });
+    connect(socket,
+            &QLocalSocket::disconnected,
+            socket,
+            &QLocalSocket::deleteLater);
+  }
+}
+
+void
+BCP47RegistryServer::readRequests(QLocalSocket* socket)
+{
+  QByteArray request;
+  bool tooLarge;
+  while (RegistryProtocol::readMessage(socket, request, tooLarge)) {
+    QByteArray reply;
+    auto ok = answer(request, reply);
+    RegistryProtocol::writeMessage(socket, reply);
+    if (!ok) {
+      emit error(tr("Bad request from registry client."));
+      socket->disconnectFromServer();
+      return;
+    }
+  }
+  if (tooLarge) {
+    emit error(tr("Registry client request too large."));
+    socket->abort();
+  }
+}
+
+bool
+BCP47RegistryServer::answer(const QByteArray& request, QByteArray& reply)
+{
+  QDataStream in(request);
+  RegistryProtocol::setup(in);
+  quint32 magic = 0, count = 0;
+  quint16 version = 0;
+  in >> magic >> version >> count;
+
+  // one snapshot answers the whole batch.
+  auto snapshot = BCP47Languages::snapshot();
+  QDataStream out(&reply, QIODevice::WriteOnly);
+  RegistryProtocol::setup(out);
+  out << RegistryProtocol::MAGIC << RegistryProtocol::VERSION
+      << snapshot.fileDate();
+
+  if (in.status() != QDataStream::Ok || magic != RegistryProtocol::MAGIC ||
+      version != RegistryProtocol::VERSION ||
+      count > RegistryProtocol::MAX_BATCH) {
+    out << quint32(0);
+    return false;
+  }
+
+  QVector<BCP47RegistryClient::Answer> answers;
+  answers.reserve(int(count));
+  for (quint32 i = 0; i < count; i++) {
+    quint8 operation = 0, type = 0;
+    QString value;
+    in >> operation >> type >> value;
+    if (in.status() != QDataStream::Ok) {
+      out << quint32(0);
+      return false;
+    }
+
+    BCP47RegistryClient::Answer answer;
+    switch (operation) {
+      case BCP47RegistryClient::Validate: {
+        auto results = m_languages->testTag(snapshot, value);
+        for (auto& result : results) {
+          answer.flags |= quint32(int(result->type));
+          answer.values.append(result->text);
+        }
+        answer.found = !results.isEmpty() &&
+                       !(answer.flags & BCP47Language::BAD_SUBTAG);
+        break;
+      }
+      case BCP47RegistryClient::Canonicalise:
+        answer.value = m_languages->canonicalTag(snapshot, value);
+        answer.found = !answer.value.isEmpty();
+        break;
+      case BCP47RegistryClient::Lookup: {
+        auto language =
+          snapshot.fromSubtag(BCP47Language::Type(type), value);
+        if (language) {
+          answer.found = true;
+          answer.flags = language->isDeprecated() ? 1 : 0;
+          answer.value = language->preferredValue();
+          answer.values = language->descriptions();
+        }
+        break;
+      }
+      case BCP47RegistryClient::Match: {
+        auto languages = snapshot.dataset().values(value);
+        for (auto& language : languages) {
+          auto type = language->type();
+          answer.values.append(type == BCP47Language::GRANDFATHERED ||
+                                   type == BCP47Language::REDUNDANT
+                                 ? language->tag()
+                                 : language->subtag());
+        }
+        answer.found = !answer.values.isEmpty();
+        break;
+      }
+      case BCP47RegistryClient::DisplayName:
+        answer.value = m_languages->displayName(snapshot, value);
+        answer.found = !answer.value.isEmpty();
+        break;
+      default:
+        break;
+    }
+    answers.append(answer);
+  }
+
+  out << quint32(answers.size());
+  for (auto& answer : answers)
+    out << quint8(answer.found) << answer.flags << answer.value
+        << answer.values;
+  return true;
+}
+
+//====================================================================
+//=== BCP47RegistryClient
+//====================================================================
+BCP47RegistryClient::BCP47RegistryClient(const QString& name)
+  : m_name(name)
+  , m_socket(new QLocalSocket())
+{}
+
+BCP47RegistryClient::~BCP47RegistryClient()
+{
+  delete m_socket;
+}
+
+bool
+BCP47RegistryClient::connectToServer(int msecs)
+{
+  if (isConnected())
+    return true;
+  m_socket->connectToServer(m_name);
+  if (!m_socket->waitForConnected(msecs)) {
+    m_errorString = m_socket->errorString();
+    m_socket->abort();
+    return false;
+  }
+  return true;
+}
+
+bool
+BCP47RegistryClient::isConnected() const
+{
+  return m_socket->state() == QLocalSocket::ConnectedState;
+}
+
+QString
+BCP47RegistryClient::errorString() const
+{
+  return m_errorString;
+}
+
+QDate
+BCP47RegistryClient::fileDate() const
+{
+  return m_fileDate;
+}
+
+QVector<BCP47RegistryClient::Answer>
+BCP47RegistryClient::query(const QVector<Query>& batch, int msecs)
+{
+  QVector<Answer> answers;
+  if (batch.isEmpty() || !connectToServer(msecs))
+    return answers;
+  answers.reserve(batch.size());
+
+  QElapsedTimer timer;
+  timer.start();
+  auto fail = [this, &answers](const QString& errorStr) {
+    m_errorString = errorStr;
+    m_socket->abort();
+    answers.clear();
+    return answers;
+  };
+
+  // larger batches are split to keep within the server's limit.
+  for (int first = 0; first < batch.size();
+       first += int(RegistryProtocol::MAX_BATCH)) {
+    auto count = qMin(batch.size() - first, int(RegistryProtocol::MAX_BATCH));
+    QByteArray request;
+    QDataStream out(&request, QIODevice::WriteOnly);
+    RegistryProtocol::setup(out);
+    out << RegistryProtocol::MAGIC << RegistryProtocol::VERSION
+        << quint32(count);
+    for (int i = first; i < first + count; i++) {
+      auto& query = batch.at(i);
+      out << quint8(query.operation) << quint8(query.type) << query.value;
+    }
+    RegistryProtocol::writeMessage(m_socket, request);
+
+    QByteArray reply;
+    bool tooLarge;
+    while (!RegistryProtocol::readMessage(m_socket, reply, tooLarge)) {
+      if (tooLarge)
+        return fail(QObject::tr("Registry server reply too large."));
+      auto remaining = msecs - timer.elapsed();
+      if (remaining <= 0 || !m_socket->waitForReadyRead(int(remaining)))
+        return fail(QObject::tr("No reply from registry server : %1")
+                      .arg(m_socket->errorString()));
+    }
+
+    QDataStream in(reply);
+    RegistryProtocol::setup(in);
+    quint32 magic = 0, answered = 0;
+    quint16 version = 0;
+    in >> magic >> version >> m_fileDate >> answered;
+    if (magic != RegistryProtocol::MAGIC ||
+        version != RegistryProtocol::VERSION || answered != quint32(count))
+      return fail(QObject::tr("Bad reply from registry server."));
+    for (int i = 0; i < count; i++) {
+      quint8 found = 0;
+      Answer answer;
+      in >> found >> answer.flags >> answer.value >> answer.values;
+      answer.found = found != 0;
+      answers.append(answer);
+    }
+    if (in.status() != QDataStream::Ok)
+      return fail(QObject::tr("Bad reply from registry server."));
+  }
+  return answers;
+}
+
+BCP47RegistryClient::Answer
+BCP47RegistryClient::single(const Query& query)
+{
+  auto answers = this->query({ query });
+  return answers.isEmpty() ? Answer() : answers.first();
+}
+
+bool
+BCP47RegistryClient::isValid(const QString& tag)
+{
+  return single({ Validate, tag }).found;
+}
+
+QString
+BCP47RegistryClient::canonicalTag(const QString& tag)
+{
+  return single({ Canonicalise, tag }).value;
+}
+
+QVector<QString>
+BCP47RegistryClient::descriptions(BCP47Language::Type type,
+                                  const QString& subtag)
+{
+  return single({ Lookup, subtag, type }).values;
+}
+
+QVector<QString>
+BCP47RegistryClient::match(const QString& description)
+{
+  return single({ Match, description }).values;
+}
+
+QString
+BCP47RegistryClient::displayName(const QString& tag)
+{
+  return single({ DisplayName, tag }).value;
+}
@@ -0,0 +1,318 @@
+#include "language/sharedregistry.h"
+#include "language/bcp47core.h"
+#include "language/registryimage.h"
+
+#include <QSharedMemory>
+#include <QThread>
+
+#include <atomic>
+#include <memory>
+#include <new>
+
+namespace {
+
+//! The contents of the control segment.
+struct Control
+{
+  quint32 magic;
+  std::atomic<quint32> generation;
+};
+static_assert(std::atomic<quint32>::is_always_lock_free,
+              "the generation must be lock free to be shared");
+
+const quint32 CONTROL_MAGIC = 0x42435047; // "BCPG"
+//! The number of generations to try when a newer one has been published
+//! while changing over.
+const int ATTACH_TRIES = 8;
+
+QString
+imageKey(const QString& key, quint32 generation)
+{
+  return key + QStringLiteral("-") + QString::number(generation);
+}
+
+//! \brief Returns the record of type for the subtag, matching case.
+//!
+//! The subtag is copied to the stack, so a lookup does not allocate. A value
+//! that is too long or is not ASCII cannot be in the registry.
+const RegistryImage::Record*
+findRecord(const RegistryImage::View& view,
+           BCP47Language::Type type,
+           const QString& subtag)
+{
+  char buffer[BCP47Core::Registry::MAX_WHOLE_TAG];
+  if (std::size_t(subtag.size()) > sizeof(buffer))
+    return nullptr;
+  for (int i = 0; i < subtag.size(); i++) {
+    auto c = subtag.at(i).unicode();
+    if (c > 0x7f)
+      return nullptr;
+    buffer[i] = char(c);
+  }
+  return view.find(type, std::string_view(buffer, std::size_t(subtag.size())));
+}
+
+QString
+toQString(std::string_view value)
+{
+  return QString::fromUtf8(value.data(), int(value.size()));
+}
+
+QVector<QString>
+toQStrings(const RegistryImage::View& view, uint32_t list)
+{
+  QVector<QString> values;
+  auto count = view.listSize(list);
+  values.reserve(int(count));
+  for (uint32_t i = 0; i < count; i++)
+    values.append(toQString(view.listAt(list, i)));
+  return values;
+}
+
+QSharedPointer<BCP47Language>
+toLanguage(const RegistryImage::View& view,
+           BCP47Language::Type type,
+           const RegistryImage::Record* record)
+{
+  if (!record)
+    return QSharedPointer<BCP47Language>();
+  auto language = QSharedPointer<BCP47Language>(new BCP47Language());
+  language->setType(type);
+  language->setSubtag(toQString(view.string(record->subtag)));
+  language->setTag(toQString(view.string(record->tag)));
+  for (auto& description : toQStrings(view, record->descriptions))
+    language->addDescription(description);
+  language->setPreferredValue(toQString(view.string(record->preferredValue)));
+  language->setSuppressScript(toQString(view.string(record->suppressScript)));
+  language->setMacrolanguageName(
+    toQString(view.string(record->macrolanguage)));
+  language->setComments(toQString(view.string(record->comments)));
+  for (auto& prefix : toQStrings(view, record->prefixes))
+    language->addPrefix(prefix);
+  if (record->added != 0)
+    language->setDateAdded(QDate::fromJulianDay(record->added));
+  language->setDeprecated(record->flags & RegistryImage::Deprecated);
+  language->setMacrolanguage(record->flags & RegistryImage::Macrolanguage);
+  language->setCollection(record->flags & RegistryImage::Collection);
+  return language;
+}
+
+} // end of anonymous namespace
+
+struct BCP47SharedRegistry::Private
+{
+  QString key;
+  QString errorString;
+  QSharedMemory control;
+  //! the image this object published, kept alive for the readers.
+  std::unique_ptr<QSharedMemory> published;
+  //! the image this object reads.
+  std::unique_ptr<QSharedMemory> attached;
+  quint32 generation = 0;
+  RegistryImage::View view;
+
+  Control* controlData()
+  {
+    return static_cast<Control*>(control.data());
+  }
+
+  bool attachControl(bool create);
+  bool attachExisting();
+  bool update();
+};
+
+bool
+BCP47SharedRegistry::Private::attachControl(bool create)
+{
+  if (control.isAttached())
+    return true;
+  if (attachExisting())
+    return true;
+  if (!create)
+    return false;
+
+  if (!control.create(sizeof(Control))) {
+    // another publisher created it first.
+    if (control.error() == QSharedMemory::AlreadyExists)
+      return attachExisting();
+    errorString = control.errorString();
+    return false;
+  }
+  // the segment starts zeroed, a reader that attaches before it is filled
+  // in waits for the lock, or sees no magic and tries again.
+  control.lock();
+  auto data = new (control.data()) Control;
+  data->generation.store(0);
+  data->magic = CONTROL_MAGIC;
+  control.unlock();
+  return true;
+}
+
+bool
+BCP47SharedRegistry::Private::attachExisting()
+{
+  for (int i = 0; i < ATTACH_TRIES; i++) {
+    if (!control.attach()) {
+      errorString = control.errorString();
+      return false;
+    }
+    // the publisher fills the segment in under the lock.
+    control.lock();
+    auto magic = controlData()->magic;
+    control.unlock();
+    if (magic == CONTROL_MAGIC)
+      return true;
+    control.detach();
+    if (magic != 0) {
+      errorString = QObject::tr("The shared memory is not a registry.");
+      return false;
+    }
+    // created but not yet filled in.
+    QThread::yieldCurrentThread();
+  }
+  errorString = QObject::tr("The shared registry was never initialised.");
+  return false;
+}
+
+bool
+BCP47SharedRegistry::Private::update()
+{
+  if (!attachControl(false))
+    return false;
+
+  auto current = controlData()->generation.load(std::memory_order_acquire);
+  for (int i = 0; i < ATTACH_TRIES && current != generation; i++) {
+    if (current == 0)
+      return false;
+    std::unique_ptr<QSharedMemory> segment(
+      new QSharedMemory(imageKey(key, current)));
+    if (!segment->attach(QSharedMemory::ReadOnly)) {
+      // a newer generation replaced it before it could be attached.
+      errorString = segment->errorString();
+      current = controlData()->generation.load(std::memory_order_acquire);
+      continue;
+    }
+
+    RegistryImage::View view(segment->constData(),
+                             std::size_t(segment->size()));
+    if (!view.isValid()) {
+      errorString = QObject::tr("The shared registry image is damaged.");
+      return false;
+    }
+    this->view = view;
+    attached = std::move(segment);
+    generation = current;
+  }
+  return current == generation && view.isValid();
+}
+
+//====================================================================
+//=== BCP47SharedRegistry
+//====================================================================
+BCP47SharedRegistry::BCP47SharedRegistry(const QString& key)
+  : d(new Private)
+{
+  d->key = key;
+  d->control.setKey(key);
+}
+
+BCP47SharedRegistry::~BCP47SharedRegistry() = default;
+
+QString
+BCP47SharedRegistry::defaultKey()
+{
+  auto user = qEnvironmentVariable("USER");
+  if (user.isEmpty())
+    user = qEnvironmentVariable("USERNAME");
+  return QStringLiteral("bcp47-registry-image-") + user;
+}
+
+bool
+BCP47SharedRegistry::publish(const BCP47Snapshot& snapshot)
+{
+  if (!d->attachControl(true))
+    return false;
+
+  auto image = snapshot.image();
+  // the lock serialises publishers, a reader only takes it to attach.
+  d->control.lock();
+  auto generation = d->controlData()->generation.load();
+  std::unique_ptr<QSharedMemory> segment;
+  for (int i = 0; i < ATTACH_TRIES; i++) {
+    // a generation left behind by a publisher that died is skipped.
+    segment.reset(new QSharedMemory(imageKey(d->key, ++generation)));
+    if (segment->create(image.size()) ||
+        segment->error() != QSharedMemory::AlreadyExists)
+      break;
+  }
+  if (!segment->isAttached()) {
+    d->errorString = segment->errorString();
+    d->control.unlock();
+    return false;
+  }
+
+  std::memcpy(segment->data(), image.constData(), std::size_t(image.size()));
+  d->controlData()->generation.store(generation, std::memory_order_release);
+  d->control.unlock();
+
+  d->published = std::move(segment);
+  return true;
+}
+
+bool
+BCP47SharedRegistry::isAvailable()
+{
+  return d->update();
+}
+
+quint32
+BCP47SharedRegistry::generation() const
+{
+  return d->generation;
+}
+
+QString
+BCP47SharedRegistry::errorString() const
+{
+  return d->errorString;
+}
+
+QDate
+BCP47SharedRegistry::fileDate()
+{
+  if (!d->update() || d->view.fileDate() == 0)
+    return QDate();
+  return QDate::fromJulianDay(d->view.fileDate());
+}
+
+QSharedPointer<BCP47Language>
+BCP47SharedRegistry::fromSubtag(BCP47Language::Type type,
+                                const QString& subtag)
+{
+  if (!d->update())
+    return QSharedPointer<BCP47Language>();
+  // only a record that is found is copied out.
+  return toLanguage(d->view, type, findRecord(d->view, type, subtag));
+}
+
+QSharedPointer<BCP47Language>
+BCP47SharedRegistry::fromDescription(BCP47Language::Type type,
+                                     const QString& description)
+{
+  if (!d->update())
+    return QSharedPointer<BCP47Language>();
+  auto text = description.toUtf8();
+  auto range = d->view.findDescription(
+    type, std::string_view(text.constData(), text.size()));
+  if (range.first == range.second)
+    return QSharedPointer<BCP47Language>();
+  // as in BCP47Snapshot a repeated description gives the last in the dataset.
+  auto last = range.second - 1;
+  return toLanguage(d->view, type, d->view.record(type, last->record));
+}
+
+bool
+BCP47SharedRegistry::contains(BCP47Language::Type type, const QString& subtag)
+{
+  return d->update() && findRecord(d->view, type, subtag);
+}
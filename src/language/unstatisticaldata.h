@@ -0,0 +1,2277 @@
+#ifndef UNSTATISTICALDATA_H
+#define UNSTATISTICALDATA_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// \cond DO_NOT_DOCUMENT
+/*!
+  \file unstatisticaldata.h
+  \brief The UN M49 country or area table used by UNStatisticalCodes.
+
+  All of the data is held in constexpr arrays so that it is placed in read-only
+  data and shared between processes through the page cache. Nothing is built
+  at runtime.
+
+  Each name column is a single block of NUL separated UTF-8 strings in the same
+  order as M49. The offset of each name within its block is calculated by the
+  compiler so that no pointer tables, and hence no relocations, are needed.
+
+  \note When adding a country or area the entry MUST be added to M49, ALPHA3
+  and every one of the name columns at the same position, and to AREAS.
+
+  The M49 region hierarchy (world, continent, sub-region, intermediate region)
+  is held as a list of links from each code to its containing region.
+ */
+namespace UNStatisticalData {
+
+//! The number of countries or areas in the table.
+constexpr std::size_t COUNT = 249;
+
+//! The UN M49 numerical codes.
+constexpr std::uint16_t M49[COUNT] = {
+  4, 248, 8, 12, 16, 20, 24, 660, 10, 28, 32, 51, 533, 36, 40, 31, 44, 48, 50,
+  52, 112, 56, 84, 204, 60, 64, 68, 535, 70, 72, 74, 76, 86, 92, 96, 100, 854,
+  108, 132, 116, 120, 124, 136, 140, 148, 152, 156, 344, 446, 162, 166, 170,
+  174, 178, 184, 188, 384, 191, 192, 531, 196, 203, 408, 180, 208, 262, 212,
+  214, 218, 818, 222, 226, 232, 233, 748, 231, 238, 234, 242, 246, 250, 254,
+  258, 260, 266, 270, 268, 276, 288, 292, 300, 304, 308, 312, 316, 320, 831,
+  324, 624, 328, 332, 334, 336, 340, 348, 352, 356, 360, 364, 368, 372, 833,
+  376, 380, 388, 392, 832, 400, 398, 404, 296, 414, 417, 418, 428, 422, 430,
+  426, 434, 438, 440, 442, 450, 454, 458, 462, 466, 470, 584, 474, 478, 480,
+  175, 484, 583, 492, 496, 499, 500, 504, 508, 104, 516, 520, 524, 528, 540,
+  554, 558, 562, 566, 570, 574, 807, 580, 578, 512, 586, 585, 591, 598, 600,
+  604, 612, 608, 616, 620, 630, 634, 410, 498, 638, 642, 643, 646, 652, 654,
+  659, 662, 663, 666, 670, 882, 674, 678, 680, 682, 686, 688, 690, 694, 702,
+  534, 703, 705, 90, 706, 710, 239, 728, 724, 144, 275, 729, 740, 744, 752, 756,
+  760, 762, 764, 626, 768, 772, 776, 780, 788, 792, 795, 796, 798, 800, 804,
+  784, 826, 834, 581, 840, 850, 858, 860, 548, 862, 704, 876, 732, 887, 894,
+  716
+};
+
+//! The ISO 3166 alpha-3 codes. An empty code means that the area has no
+//! alpha-3 code assigned (Sark).
+constexpr char ALPHA3[COUNT][4] = {
+  "AFG", "ALA", "ALB", "DZA", "ASM", "AND", "AGO", "AIA", "ATA", "ATG", "ARG",
+  "ARM", "ABW", "AUS", "AUT", "AZE", "BHS", "BHR", "BGD", "BRB", "BLR", "BEL",
+  "BLZ", "BEN", "BMU", "BTN", "BOL", "BES", "BIH", "BWA", "BVT", "BRA", "IOT",
+  "VGB", "BRN", "BGR", "BFA", "BDI", "CPV", "KHM", "CMR", "CAN", "CYM", "CAF",
+  "TCD", "CHL", "CHN", "HKG", "MAC", "CXR", "CCK", "COL", "COM", "COG", "COK",
+  "CRI", "CIV", "HRV", "CUB", "CUW", "CYP", "CZE", "PRK", "COD", "DNK", "DJI",
+  "DMA", "DOM", "ECU", "EGY", "SLV", "GNQ", "ERI", "EST", "SWZ", "ETH", "FLK",
+  "FRO", "FJI", "FIN", "FRA", "GUF", "PYF", "ATF", "GAB", "GMB", "GEO", "DEU",
+  "GHA", "GIB", "GRC", "GRL", "GRD", "GLP", "GUM", "GTM", "GGY", "GIN", "GNB",
+  "GUY", "HTI", "HMD", "VAT", "HND", "HUN", "ISL", "IND", "IDN", "IRN", "IRQ",
+  "IRL", "IMN", "ISR", "ITA", "JAM", "JPN", "JEY", "JOR", "KAZ", "KEN", "KIR",
+  "KWT", "KGZ", "LAO", "LVA", "LBN", "LBR", "LSO", "LBY", "LIE", "LTU", "LUX",
+  "MDG", "MWI", "MYS", "MDV", "MLI", "MLT", "MHL", "MTQ", "MRT", "MUS", "MYT",
+  "MEX", "FSM", "MCO", "MNG", "MNE", "MSR", "MAR", "MOZ", "MMR", "NAM", "NRU",
+  "NPL", "NLD", "NCL", "NZL", "NIC", "NER", "NGA", "NIU", "NFK", "MKD", "MNP",
+  "NOR", "OMN", "PAK", "PLW", "PAN", "PNG", "PRY", "PER", "PCN", "PHL", "POL",
+  "PRT", "PRI", "QAT", "KOR", "MDA", "REU", "ROU", "RUS", "RWA", "BLM", "SHN",
+  "KNA", "LCA", "MAF", "SPM", "VCT", "WSM", "SMR", "STP", "", "SAU", "SEN",
+  "SRB", "SYC", "SLE", "SGP", "SXM", "SVK", "SVN", "SLB", "SOM", "ZAF", "SGS",
+  "SSD", "ESP", "LKA", "PSE", "SDN", "SUR", "SJM", "SWE", "CHE", "SYR", "TJK",
+  "THA", "TLS", "TGO", "TKL", "TON", "TTO", "TUN", "TUR", "TKM", "TCA", "TUV",
+  "UGA", "UKR", "ARE", "GBR", "TZA", "UMI", "USA", "VIR", "URY", "UZB", "VUT",
+  "VEN", "VNM", "WLF", "ESH", "YEM", "ZMB", "ZWE"
+};
+
+// clang-format off
+//! The English names, one per M49 entry.
+constexpr char ENGLISH_NAMES[] =
+  "Afghanistan\0"
+  "Åland Islands\0"
+  "Albania\0"
+  "Algeria\0"
+  "American Samoa\0"
+  "Andorra\0"
+  "Angola\0"
+  "Anguilla\0"
+  "Antarctica\0"
+  "Antigua and Barbuda\0"
+  "Argentina\0"
+  "Armenia\0"
+  "Aruba\0"
+  "Australia\0"
+  "Austria\0"
+  "Azerbaijan\0"
+  "Bahamas\0"
+  "Bahrain\0"
+  "Bangladesh\0"
+  "Barbados\0"
+  "Belarus\0"
+  "Belgium\0"
+  "Belize\0"
+  "Benin\0"
+  "Bermuda\0"
+  "Bhutan\0"
+  "Bolivia (Plurinational State of)\0"
+  "Bonaire, Sint Eustatius and Saba\0"
+  "Bosnia and Herzegovina\0"
+  "Botswana\0"
+  "Bouvet Island\0"
+  "Brazil\0"
+  "British Indian Ocean Territory\0"
+  "British Virgin Islands\0"
+  "Brunei Darussalam\0"
+  "Bulgaria\0"
+  "Burkina Faso\0"
+  "Burundi\0"
+  "Cabo Verde\0"
+  "Cambodia\0"
+  "Cameroon\0"
+  "Canada\0"
+  "Cayman Islands\0"
+  "Central African Republic\0"
+  "Chad\0"
+  "Chile\0"
+  "China\0"
+  "China, Hong Kong Special Administrative Region\0"
+  "China, Macao Special Administrative Region\0"
+  "Christmas Island\0"
+  "Cocos (Keeling) Islands\0"
+  "Colombia\0"
+  "Comoros\0"
+  "Congo\0"
+  "Cook Islands\0"
+  "Costa Rica\0"
+  "Côte d’Ivoire\0"
+  "Croatia\0"
+  "Cuba\0"
+  "Curaçao\0"
+  "Cyprus\0"
+  "Czechia\0"
+  "Democratic People's Republic of Korea\0"
+  "Democratic Republic of the Congo\0"
+  "Denmark\0"
+  "Djibouti\0"
+  "Dominica\0"
+  "Dominican Republic\0"
+  "Ecuador\0"
+  "Egypt\0"
+  "El Salvador\0"
+  "Equatorial Guinea\0"
+  "Eritrea\0"
+  "Estonia\0"
+  "Eswatini\0"
+  "Ethiopia\0"
+  "Falkland Islands (Malvinas)\0"
+  "Faroe Islands\0"
+  "Fiji\0"
+  "Finland\0"
+  "France\0"
+  "French Guiana\0"
+  "French Polynesia\0"
+  "French Southern Territories\0"
+  "Gabon\0"
+  "Gambia\0"
+  "Georgia\0"
+  "Germany\0"
+  "Ghana\0"
+  "Gibraltar\0"
+  "Greece\0"
+  "Greenland\0"
+  "Grenada\0"
+  "Guadeloupe\0"
+  "Guam\0"
+  "Guatemala\0"
+  "Guernsey\0"
+  "Guinea\0"
+  "Guinea-Bissau\0"
+  "Guyana\0"
+  "Haiti\0"
+  "Heard Island and McDonald Islands\0"
+  "Holy See\0"
+  "Honduras\0"
+  "Hungary\0"
+  "Iceland\0"
+  "India\0"
+  "Indonesia\0"
+  "Iran (Islamic Republic of)\0"
+  "Iraq\0"
+  "Ireland\0"
+  "Isle of Man\0"
+  "Israel\0"
+  "Italy\0"
+  "Jamaica\0"
+  "Japan\0"
+  "Jersey\0"
+  "Jordan\0"
+  "Kazakhstan\0"
+  "Kenya\0"
+  "Kiribati\0"
+  "Kuwait\0"
+  "Kyrgyzstan\0"
+  "Lao People's Democratic Republic\0"
+  "Latvia\0"
+  "Lebanon\0"
+  "Liberia\0"
+  "Lesotho\0"
+  "Libya\0"
+  "Liechtenstein\0"
+  "Lithuania\0"
+  "Luxembourg\0"
+  "Madagascar\0"
+  "Malawi\0"
+  "Malaysia\0"
+  "Maldives\0"
+  "Mali\0"
+  "Malta\0"
+  "Marshall Islands\0"
+  "Martinique\0"
+  "Mauritania\0"
+  "Mauritius\0"
+  "Mayotte\0"
+  "Mexico\0"
+  "Micronesia (Federated States of)\0"
+  "Monaco\0"
+  "Mongolia\0"
+  "Montenegro\0"
+  "Montserrat\0"
+  "Morocco\0"
+  "Mozambique\0"
+  "Myanmar\0"
+  "Namibia\0"
+  "Nauru\0"
+  "Nepal\0"
+  "Netherlands\0"
+  "New Caledonia\0"
+  "New Zealand\0"
+  "Nicaragua\0"
+  "Niger\0"
+  "Nigeria\0"
+  "Niue\0"
+  "Norfolk Island\0"
+  "North Macedonia\0"
+  "Northern Mariana Islands\0"
+  "Norway\0"
+  "Oman\0"
+  "Pakistan\0"
+  "Palau\0"
+  "Panama\0"
+  "Papua New Guinea\0"
+  "Paraguay\0"
+  "Peru\0"
+  "Pitcairn\0"
+  "Philippines\0"
+  "Poland\0"
+  "Portugal\0"
+  "Puerto Rico\0"
+  "Qatar\0"
+  "Republic of Korea\0"
+  "Republic of Moldova\0"
+  "Réunion\0"
+  "Romania\0"
+  "Russian Federation\0"
+  "Rwanda\0"
+  "Saint Barthélemy\0"
+  "Saint Helena\0"
+  "Saint Kitts and Nevis\0"
+  "Saint Lucia\0"
+  "Saint Martin (French Part)\0"
+  "Saint Pierre and Miquelon\0"
+  "Saint Vincent and the Grenadines\0"
+  "Samoa\0"
+  "San Marino\0"
+  "Sao Tome and Principe\0"
+  "Sark\0"
+  "Saudi Arabia\0"
+  "Senegal\0"
+  "Serbia\0"
+  "Seychelles\0"
+  "Sierra Leone\0"
+  "Singapore\0"
+  "Sint Maarten (Dutch part)\0"
+  "Slovakia\0"
+  "Slovenia\0"
+  "Solomon Islands\0"
+  "Somalia\0"
+  "South Africa\0"
+  "South Georgia and the South Sandwich Islands\0"
+  "South Sudan\0"
+  "Spain\0"
+  "Sri Lanka\0"
+  "State of Palestine\0"
+  "Sudan\0"
+  "Suriname\0"
+  "Svalbard and Jan Mayen Islands\0"
+  "Sweden\0"
+  "Switzerland\0"
+  "Syrian Arab Republic\0"
+  "Tajikistan\0"
+  "Thailand\0"
+  "Timor-Leste\0"
+  "Togo\0"
+  "Tokelau\0"
+  "Tonga\0"
+  "Trinidad and Tobago\0"
+  "Tunisia\0"
+  "Turkey\0"
+  "Turkmenistan\0"
+  "Turks and Caicos Islands\0"
+  "Tuvalu\0"
+  "Uganda\0"
+  "Ukraine\0"
+  "United Arab Emirates\0"
+  "United Kingdom of Great Britain and Northern Ireland\0"
+  "United Republic of Tanzania\0"
+  "United States Minor Outlying Islands\0"
+  "United States of America\0"
+  "United States Virgin Islands\0"
+  "Uruguay\0"
+  "Uzbekistan\0"
+  "Vanuatu\0"
+  "Venezuela (Bolivarian Republic of)\0"
+  "Viet Nam\0"
+  "Wallis and Futuna Islands\0"
+  "Western Sahara\0"
+  "Yemen\0"
+  "Zambia\0"
+  "Zimbabwe\0";
+
+//! The Russian names, one per M49 entry.
+constexpr char RUSSIAN_NAMES[] =
+  "Афганистан\0"
+  "Аландских островов\0"
+  "Албания\0"
+  "Алжир\0"
+  "Американское Самоа\0"
+  "Андорра\0"
+  "Ангола\0"
+  "Ангилья\0"
+  "Антарктике\0"
+  "Антигуа и Барбуда\0"
+  "Аргентина\0"
+  "Армения\0"
+  "Аруба\0"
+  "Австралия\0"
+  "Австрия\0"
+  "Азербайджан\0"
+  "Багамские Острова\0"
+  "Бахрейн\0"
+  "Бангладеш\0"
+  "Барбадос\0"
+  "Беларусь\0"
+  "Бельгия\0"
+  "Белиз\0"
+  "Бенин\0"
+  "Бермудские острова\0"
+  "Бутан\0"
+  "Боливия (Многонациональное Государство)\0"
+  "Бонайре, Синт-Эстатиус и Саба\0"
+  "Босния и Герцеговина\0"
+  "Ботсвана\0"
+  "Остров Буве\0"
+  "Бразилия\0"
+  "Британская территория в Индийском океане\0"
+  "Британские Виргинские острова\0"
+  "Бруней-Даруссалам\0"
+  "Болгария\0"
+  "Буркина-Фасо\0"
+  "Бурунди\0"
+  "Кабо-Верде\0"
+  "Камбоджа\0"
+  "Камерун\0"
+  "Канада\0"
+  "Кайман острова\0"
+  "Центральноафриканская Республика\0"
+  "Чад\0"
+  "Чили\0"
+  "Китай\0"
+  "Китай, Специальный административный район Гонконг\0"
+  "Китай, Специальный административный район Макао\0"
+  "остров Рождества\0"
+  "Кокосовых (Килинг) островов\0"
+  "Колумбия\0"
+  "Коморские Острова\0"
+  "Конго\0"
+  "Острова Кука\0"
+  "Коста-Рика\0"
+  "Кот-д'Ивуар\0"
+  "Хорватия\0"
+  "Куба\0"
+  "Кюрасао\0"
+  "Кипр\0"
+  "Чехия\0"
+  "Корейская Народно-Демократическая Республика\0"
+  "Демократическая Республика Конго\0"
+  "Дания\0"
+  "Джибути\0"
+  "Доминика\0"
+  "Доминиканская Республика\0"
+  "Эквадор\0"
+  "Египет\0"
+  "Сальвадор\0"
+  "Экваториальная Гвинея\0"
+  "Эритрея\0"
+  "Эстония\0"
+  "Эсватини\0"
+  "Эфиопия\0"
+  "Фолклендские (Мальвинские) острова\0"
+  "Фарерские острова\0"
+  "Фиджи\0"
+  "Финляндия\0"
+  "Франция\0"
+  "Французская Гвиана\0"
+  "Французская Полинезия\0"
+  "Южные земли (французская заморская территория)\0"
+  "Габон\0"
+  "Гамбия\0"
+  "Грузия\0"
+  "Германия\0"
+  "Гана\0"
+  "Гибралтар\0"
+  "Греция\0"
+  "Гренландия\0"
+  "Гренада\0"
+  "Гваделупа\0"
+  "Гуам\0"
+  "Гватемала\0"
+  "Гернси\0"
+  "Гвинея\0"
+  "Гвинея-Бисау\0"
+  "Гайана\0"
+  "Гаити\0"
+  "Остров Херд и острова Макдональд\0"
+  "Святой Престол\0"
+  "Гондурас\0"
+  "Венгрия\0"
+  "Исландия\0"
+  "Индия\0"
+  "Индонезия\0"
+  "Иран (Исламская Республика)\0"
+  "Ирак\0"
+  "Ирландия\0"
+  "Остров Мэн\0"
+  "Израиль\0"
+  "Италия\0"
+  "Ямайка\0"
+  "Япония\0"
+  "Джерси\0"
+  "Иордания\0"
+  "Казахстан\0"
+  "Кения\0"
+  "Кирибати\0"
+  "Кувейт\0"
+  "Кыргызстан\0"
+  "Лаосская Народно-Демократическая Республика\0"
+  "Латвия\0"
+  "Ливан\0"
+  "Либерия\0"
+  "Лесото\0"
+  "Ливия\0"
+  "Лихтенштейн\0"
+  "Литва\0"
+  "Люксембург\0"
+  "Мадагаскар\0"
+  "Малави\0"
+  "Малайзия\0"
+  "Мальдивские Острова\0"
+  "Мали\0"
+  "Мальта\0"
+  "Маршалловы Острова\0"
+  "Мартиника\0"
+  "Мавритания\0"
+  "Маврикий\0"
+  "Остров Майотта\0"
+  "Мексика\0"
+  "Микронезия (Федеративные Штаты)\0"
+  "Монако\0"
+  "Монголия\0"
+  "Черногория\0"
+  "Монтсеррат\0"
+  "Марокко\0"
+  "Мозамбик\0"
+  "Мьянма\0"
+  "Намибия\0"
+  "Науру\0"
+  "Непал\0"
+  "Нидерланды\0"
+  "Новая Каледония\0"
+  "Новая Зеландия\0"
+  "Никарагуа\0"
+  "Нигер\0"
+  "Нигерия\0"
+  "Ниуэ\0"
+  "Остров Норфолк\0"
+  "Северная Македония\0"
+  "Северные Марианские острова\0"
+  "Норвегия\0"
+  "Оман\0"
+  "Пакистан\0"
+  "Палау\0"
+  "Панама\0"
+  "Папуа-Новая Гвинея\0"
+  "Парагвай\0"
+  "Перу\0"
+  "Питкэрн\0"
+  "Филиппины\0"
+  "Польша\0"
+  "Португалия\0"
+  "Пуэрто-Рико\0"
+  "Катар\0"
+  "Республика Корея\0"
+  "Республика Молдова\0"
+  "Реюньон\0"
+  "Румыния\0"
+  "Российская Федерация\0"
+  "Руанда\0"
+  "Сен-Бартелеми\0"
+  "Остров Святой Елены\0"
+  "Сент-Китс и Невис\0"
+  "Сент-Люсия\0"
+  "Сен-Мартен (французская часть)\0"
+  "Сен-Пьер и Микелон\0"
+  "Сент-Винсент и Гренадины\0"
+  "Самоа\0"
+  "Сан-Марино\0"
+  "Сан-Томе и Принсипи\0"
+  "Сарк\0"
+  "Саудовская Аравия\0"
+  "Сенегал\0"
+  "Сербия\0"
+  "Сейшельские Острова\0"
+  "Сьерра-Леоне\0"
+  "Сингапур\0"
+  "Синт-Мартен (нидерландская часть)\0"
+  "Словакия\0"
+  "Словения\0"
+  "Соломоновы Острова\0"
+  "Сомали\0"
+  "Южная Африка\0"
+  "Южная Джорджия и Южные Сандвичевы острова\0"
+  "Южный Судан\0"
+  "Испания\0"
+  "Шри-Ланка\0"
+  "Государство Палестина\0"
+  "Судан\0"
+  "Суринам\0"
+  "Острова Свальбард и Ян-Майен\0"
+  "Швеция\0"
+  "Швейцария\0"
+  "Сирийская Арабская Республика\0"
+  "Таджикистан\0"
+  "Таиланд\0"
+  "Тимор-Лешти\0"
+  "Того\0"
+  "Токелау\0"
+  "Тонга\0"
+  "Тринидад и Тобаго\0"
+  "Тунис\0"
+  "Турция\0"
+  "Туркменистан\0"
+  "Острова Теркс и Кайкос\0"
+  "Тувалу\0"
+  "Уганда\0"
+  "Украина\0"
+  "Объединенные Арабские Эмираты\0"
+  "Соединенное Королевство Великобритании и Северной Ирландии\0"
+  "Объединенная Республика Танзания\0"
+  "Внешние малые острова Соединенных Штатов\0"
+  "Соединенные Штаты Америки\0"
+  "Виргинские острова Соединенных Штатов\0"
+  "Уругвай\0"
+  "Узбекистан\0"
+  "Вануату\0"
+  "Венесуэла (Боливарианская Республика)\0"
+  "Вьетнам\0"
+  "Острова Уоллис и Футуна\0"
+  "Западная Сахара\0"
+  "Йемен\0"
+  "Замбия\0"
+  "Зимбабве\0";
+
+//! The Chinese names, one per M49 entry.
+constexpr char CHINESE_NAMES[] =
+  "阿富汗\0"
+  "奥兰群岛\0"
+  "阿尔巴尼亚\0"
+  "阿尔及利亚\0"
+  "美属萨摩亚\0"
+  "安道尔\0"
+  "安哥拉\0"
+  "安圭拉\0"
+  "南极洲\0"
+  "安提瓜和巴布达\0"
+  "阿根廷\0"
+  "亚美尼亚\0"
+  "阿鲁巴\0"
+  "澳大利亚\0"
+  "奥地利\0"
+  "阿塞拜疆\0"
+  "巴哈马\0"
+  "巴林\0"
+  "孟加拉国\0"
+  "巴巴多斯\0"
+  "白俄罗斯\0"
+  "比利时\0"
+  "伯利兹\0"
+  "贝宁\0"
+  "百慕大\0"
+  "不丹\0"
+  "多民族玻利维亚国\0"
+  "博纳尔，圣俄斯塔休斯和萨巴\0"
+  "波斯尼亚和黑塞哥维那\0"
+  "博茨瓦纳\0"
+  "布维岛\0"
+  "巴西\0"
+  "英属印度洋领土\0"
+  "英属维尔京群岛\0"
+  "文莱达鲁萨兰国\0"
+  "保加利亚\0"
+  "布基纳法索\0"
+  "布隆迪\0"
+  "佛得角\0"
+  "柬埔寨\0"
+  "喀麦隆\0"
+  "加拿大\0"
+  "开曼群岛\0"
+  "中非共和国\0"
+  "乍得\0"
+  "智利\0"
+  "中国\0"
+  "中国香港特别行政区\0"
+  "中国澳门特别行政区\0"
+  "圣诞岛\0"
+  "科科斯（基林）群岛\0"
+  "哥伦比亚\0"
+  "科摩罗\0"
+  "刚果\0"
+  "库克群岛\0"
+  "哥斯达黎加\0"
+  "科特迪瓦\0"
+  "克罗地亚\0"
+  "古巴\0"
+  "库拉索\0"
+  "塞浦路斯\0"
+  "捷克\0"
+  "朝鲜民主主义人民共和国\0"
+  "刚果民主共和国\0"
+  "丹麦\0"
+  "吉布提\0"
+  "多米尼克\0"
+  "多米尼加\0"
+  "厄瓜多尔\0"
+  "埃及\0"
+  "萨尔瓦多\0"
+  "赤道几内亚\0"
+  "厄立特里亚\0"
+  "爱沙尼亚\0"
+  "斯威士兰\0"
+  "埃塞俄比亚\0"
+  "福克兰群岛（马尔维纳斯）\0"
+  "法罗群岛\0"
+  "斐济\0"
+  "芬兰\0"
+  "法国\0"
+  "法属圭亚那\0"
+  "法属波利尼西亚\0"
+  "法属南方领地\0"
+  "加蓬\0"
+  "冈比亚\0"
+  "格鲁吉亚\0"
+  "德国\0"
+  "加纳\0"
+  "直布罗陀\0"
+  "希腊\0"
+  "格陵兰\0"
+  "格林纳达\0"
+  "瓜德罗普\0"
+  "关岛\0"
+  "危地马拉\0"
+  "格恩西\0"
+  "几内亚\0"
+  "几内亚比绍\0"
+  "圭亚那\0"
+  "海地\0"
+  "赫德岛和麦克唐纳岛\0"
+  "教廷\0"
+  "洪都拉斯\0"
+  "匈牙利\0"
+  "冰岛\0"
+  "印度\0"
+  "印度尼西亚\0"
+  "伊朗伊斯兰共和国\0"
+  "伊拉克\0"
+  "爱尔兰\0"
+  "马恩岛\0"
+  "以色列\0"
+  "意大利\0"
+  "牙买加\0"
+  "日本\0"
+  "泽西\0"
+  "约旦\0"
+  "哈萨克斯坦\0"
+  "肯尼亚\0"
+  "基里巴斯\0"
+  "科威特\0"
+  "吉尔吉斯斯坦\0"
+  "老挝人民民主共和国\0"
+  "拉脱维亚\0"
+  "黎巴嫩\0"
+  "利比里亚\0"
+  "莱索托\0"
+  "利比亚\0"
+  "列支敦士登\0"
+  "立陶宛\0"
+  "卢森堡\0"
+  "马达加斯加\0"
+  "马拉维\0"
+  "马来西亚\0"
+  "马尔代夫\0"
+  "马里\0"
+  "马耳他\0"
+  "马绍尔群岛\0"
+  "马提尼克\0"
+  "毛里塔尼亚\0"
+  "毛里求斯\0"
+  "马约特\0"
+  "墨西哥\0"
+  "密克罗尼西亚联邦\0"
+  "摩纳哥\0"
+  "蒙古\0"
+  "黑山\0"
+  "蒙特塞拉特\0"
+  "摩洛哥\0"
+  "莫桑比克\0"
+  "缅甸\0"
+  "纳米比亚\0"
+  "瑙鲁\0"
+  "尼泊尔\0"
+  "荷兰\0"
+  "新喀里多尼亚\0"
+  "新西兰\0"
+  "尼加拉瓜\0"
+  "尼日尔\0"
+  "尼日利亚\0"
+  "纽埃\0"
+  "诺福克岛\0"
+  "北马其顿\0"
+  "北马里亚纳群岛\0"
+  "挪威\0"
+  "阿曼\0"
+  "巴基斯坦\0"
+  "帕劳\0"
+  "巴拿马\0"
+  "巴布亚新几内亚\0"
+  "巴拉圭\0"
+  "秘鲁\0"
+  "皮特凯恩\0"
+  "菲律宾\0"
+  "波兰\0"
+  "葡萄牙\0"
+  "波多黎各\0"
+  "卡塔尔\0"
+  "大韩民国\0"
+  "摩尔多瓦共和国\0"
+  "留尼汪\0"
+  "罗马尼亚\0"
+  "俄罗斯联邦\0"
+  "卢旺达\0"
+  "圣巴泰勒米\0"
+  "圣赫勒拿\0"
+  "圣基茨和尼维斯\0"
+  "圣卢西亚\0"
+  "圣马丁（法属）\0"
+  "圣皮埃尔和密克隆\0"
+  "圣文森特和格林纳丁斯\0"
+  "萨摩亚\0"
+  "圣马力诺\0"
+  "圣多美和普林西比\0"
+  "萨克\0"
+  "沙特阿拉伯\0"
+  "塞内加尔\0"
+  "塞尔维亚\0"
+  "塞舌尔\0"
+  "塞拉利昂\0"
+  "新加坡\0"
+  "圣马丁（荷属）\0"
+  "斯洛伐克\0"
+  "斯洛文尼亚\0"
+  "所罗门群岛\0"
+  "索马里\0"
+  "南非\0"
+  "南乔治亚岛和南桑德韦奇岛\0"
+  "南苏丹\0"
+  "西班牙\0"
+  "斯里兰卡\0"
+  "巴勒斯坦国\0"
+  "苏丹\0"
+  "苏里南\0"
+  "斯瓦尔巴群岛和扬马延岛\0"
+  "瑞典\0"
+  "瑞士\0"
+  "阿拉伯叙利亚共和国\0"
+  "塔吉克斯坦\0"
+  "泰国\0"
+  "东帝汶\0"
+  "多哥\0"
+  "托克劳\0"
+  "汤加\0"
+  "特立尼达和多巴哥\0"
+  "突尼斯\0"
+  "土耳其\0"
+  "土库曼斯坦\0"
+  "特克斯和凯科斯群岛\0"
+  "图瓦卢\0"
+  "乌干达\0"
+  "乌克兰\0"
+  "阿拉伯联合酋长国\0"
+  "大不列颠及北爱尔兰联合王国\0"
+  "坦桑尼亚联合共和国\0"
+  "美国本土外小岛屿\0"
+  "美利坚合众国\0"
+  "美属维尔京群岛\0"
+  "乌拉圭\0"
+  "乌兹别克斯坦\0"
+  "瓦努阿图\0"
+  "委内瑞拉玻利瓦尔共和国\0"
+  "越南\0"
+  "瓦利斯群岛和富图纳群岛\0"
+  "西撒哈拉\0"
+  "也门\0"
+  "赞比亚\0"
+  "津巴布韦\0";
+
+//! The French names, one per M49 entry.
+constexpr char FRENCH_NAMES[] =
+  "Afghanistan\0"
+  "Îles d’Åland\0"
+  "Albanie\0"
+  "Algérie\0"
+  "Samoa américaines\0"
+  "Andorre\0"
+  "Angola\0"
+  "Anguilla\0"
+  "Antarctique\0"
+  "Antigua-et-Barbuda\0"
+  "Argentine\0"
+  "Arménie\0"
+  "Aruba\0"
+  "Australie\0"
+  "Autriche\0"
+  "Azerbaïdjan\0"
+  "Bahamas\0"
+  "Bahreïn\0"
+  "Bangladesh\0"
+  "Barbade\0"
+  "Bélarus\0"
+  "Belgique\0"
+  "Belize\0"
+  "Bénin\0"
+  "Bermudes\0"
+  "Bhoutan\0"
+  "Bolivie (État plurinational de)\0"
+  "Bonaire, Saint-Eustache et Saba\0"
+  "Bosnie-Herzégovine\0"
+  "Botswana\0"
+  "Île Bouvet\0"
+  "Brésil\0"
+  "Territoire britannique de l'océan Indien\0"
+  "Îles Vierges britanniques\0"
+  "Brunéi Darussalam\0"
+  "Bulgarie\0"
+  "Burkina Faso\0"
+  "Burundi\0"
+  "Cabo Verde\0"
+  "Cambodge\0"
+  "Cameroun\0"
+  "Canada\0"
+  "Îles Caïmanes\0"
+  "République centrafricaine\0"
+  "Tchad\0"
+  "Chili\0"
+  "Chine\0"
+  "Chine, région administrative spéciale de Hong Kong\0"
+  "Chine, région administrative spéciale de Macao\0"
+  "Île Christmas\0"
+  "Îles des Cocos (Keeling)\0"
+  "Colombie\0"
+  "Comores\0"
+  "Congo\0"
+  "Îles Cook\0"
+  "Costa Rica\0"
+  "Côte d’Ivoire\0"
+  "Croatie\0"
+  "Cuba\0"
+  "Curaçao\0"
+  "Chypre\0"
+  "Tchéquie\0"
+  "République populaire démocratique de Corée\0"
+  "République démocratique du Congo\0"
+  "Danemark\0"
+  "Djibouti\0"
+  "Dominique\0"
+  "République dominicaine\0"
+  "Équateur\0"
+  "Égypte\0"
+  "El Salvador\0"
+  "Guinée équatoriale\0"
+  "Érythrée\0"
+  "Estonie\0"
+  "Eswatini\0"
+  "Éthiopie\0"
+  "Îles Falkland (Malvinas)\0"
+  "Îles Féroé\0"
+  "Fidji\0"
+  "Finlande\0"
+  "France\0"
+  "Guyane française\0"
+  "Polynésie française\0"
+  "Terres australes françaises\0"
+  "Gabon\0"
+  "Gambie\0"
+  "Géorgie\0"
+  "Allemagne\0"
+  "Ghana\0"
+  "Gibraltar\0"
+  "Grèce\0"
+  "Groenland\0"
+  "Grenade\0"
+  "Guadeloupe\0"
+  "Guam\0"
+  "Guatemala\0"
+  "Guernesey\0"
+  "Guinée\0"
+  "Guinée-Bissau\0"
+  "Guyana\0"
+  "Haïti\0"
+  "Île Heard-et-Îles MacDonald\0"
+  "Saint-Siège\0"
+  "Honduras\0"
+  "Hongrie\0"
+  "Islande\0"
+  "Inde\0"
+  "Indonésie\0"
+  "Iran (République islamique d’)\0"
+  "Iraq\0"
+  "Irlande\0"
+  "Île de Man\0"
+  "Israël\0"
+  "Italie\0"
+  "Jamaïque\0"
+  "Japon\0"
+  "Jersey\0"
+  "Jordanie\0"
+  "Kazakhstan\0"
+  "Kenya\0"
+  "Kiribati\0"
+  "Koweït\0"
+  "Kirghizistan\0"
+  "République démocratique populaire lao\0"
+  "Lettonie\0"
+  "Liban\0"
+  "Libéria\0"
+  "Lesotho\0"
+  "Libye\0"
+  "Liechtenstein\0"
+  "Lituanie\0"
+  "Luxembourg\0"
+  "Madagascar\0"
+  "Malawi\0"
+  "Malaisie\0"
+  "Maldives\0"
+  "Mali\0"
+  "Malte\0"
+  "Îles Marshall\0"
+  "Martinique\0"
+  "Mauritanie\0"
+  "Maurice\0"
+  "Mayotte\0"
+  "Mexique\0"
+  "Micronésie (États fédérés de)\0"
+  "Monaco\0"
+  "Mongolie\0"
+  "Monténégro\0"
+  "Montserrat\0"
+  "Maroc\0"
+  "Mozambique\0"
+  "Myanmar\0"
+  "Namibie\0"
+  "Nauru\0"
+  "Népal\0"
+  "Pays-Bas\0"
+  "Nouvelle-Calédonie\0"
+  "Nouvelle-Zélande\0"
+  "Nicaragua\0"
+  "Niger\0"
+  "Nigéria\0"
+  "Nioué\0"
+  "Île Norfolk\0"
+  "Macédoine du Nord\0"
+  "Îles Mariannes du Nord\0"
+  "Norvège\0"
+  "Oman\0"
+  "Pakistan\0"
+  "Palaos\0"
+  "Panama\0"
+  "Papouasie-Nouvelle-Guinée\0"
+  "Paraguay\0"
+  "Pérou\0"
+  "Pitcairn\0"
+  "Philippines\0"
+  "Pologne\0"
+  "Portugal\0"
+  "Porto Rico\0"
+  "Qatar\0"
+  "République de Corée\0"
+  "République de Moldova\0"
+  "Réunion\0"
+  "Roumanie\0"
+  "Fédération de Russie\0"
+  "Rwanda\0"
+  "Saint-Barthélemy\0"
+  "Sainte-Hélène\0"
+  "Saint-Kitts-et-Nevis\0"
+  "Sainte-Lucie\0"
+  "Saint-Martin (partie française)\0"
+  "Saint-Pierre-et-Miquelon\0"
+  "Saint-Vincent-et-les Grenadines\0"
+  "Samoa\0"
+  "Saint-Marin\0"
+  "Sao Tomé-et-Principe\0"
+  "Sercq\0"
+  "Arabie saoudite\0"
+  "Sénégal\0"
+  "Serbie\0"
+  "Seychelles\0"
+  "Sierra Leone\0"
+  "Singapour\0"
+  "Saint-Martin (partie néerlandaise)\0"
+  "Slovaquie\0"
+  "Slovénie\0"
+  "Îles Salomon\0"
+  "Somalie\0"
+  "Afrique du Sud\0"
+  "Géorgie du Sud-et-les Îles Sandwich du Sud\0"
+  "Soudan du Sud\0"
+  "Espagne\0"
+  "Sri Lanka\0"
+  "État de Palestine\0"
+  "Soudan\0"
+  "Suriname\0"
+  "Îles Svalbard-et-Jan Mayen\0"
+  "Suède\0"
+  "Suisse\0"
+  "République arabe syrienne\0"
+  "Tadjikistan\0"
+  "Thaïlande\0"
+  "Timor-Leste\0"
+  "Togo\0"
+  "Tokélaou\0"
+  "Tonga\0"
+  "Trinité-et-Tobago\0"
+  "Tunisie\0"
+  "Turquie\0"
+  "Turkménistan\0"
+  "Îles Turques-et-Caïques\0"
+  "Tuvalu\0"
+  "Ouganda\0"
+  "Ukraine\0"
+  "Émirats arabes unis\0"
+  "Royaume-Uni de Grande-Bretagne et d’Irlande du Nord\0"
+  "République-Unie de Tanzanie\0"
+  "Îles mineures éloignées des États-Unis\0"
+  "États-Unis d’Amérique\0"
+  "Îles Vierges américaines\0"
+  "Uruguay\0"
+  "Ouzbékistan\0"
+  "Vanuatu\0"
+  "Venezuela (République bolivarienne du)\0"
+  "Viet Nam\0"
+  "Îles Wallis-et-Futuna\0"
+  "Sahara occidental\0"
+  "Yémen\0"
+  "Zambie\0"
+  "Zimbabwe\0";
+
+//! The Spanish names, one per M49 entry.
+constexpr char SPANISH_NAMES[] =
+  "Afganistán\0"
+  "Islas Åland\0"
+  "Albania\0"
+  "Argelia\0"
+  "Samoa Americana\0"
+  "Andorra\0"
+  "Angola\0"
+  "Anguila\0"
+  "Antártida\0"
+  "Antigua y Barbuda\0"
+  "Argentina\0"
+  "Armenia\0"
+  "Aruba\0"
+  "Australia\0"
+  "Austria\0"
+  "Azerbaiyán\0"
+  "Bahamas\0"
+  "Bahrein\0"
+  "Bangladesh\0"
+  "Barbados\0"
+  "Belarús\0"
+  "Bélgica\0"
+  "Belice\0"
+  "Benin\0"
+  "Bermuda\0"
+  "Bhután\0"
+  "Bolivia (Estado Plurinacional de)\0"
+  "Bonaire, San Eustaquio y Saba\0"
+  "Bosnia y Herzegovina\0"
+  "Botswana\0"
+  "Isla Bouvet\0"
+  "Brasil\0"
+  "Territorio Británico del Océano Índico\0"
+  "Islas Vírgenes Británicas\0"
+  "Brunei Darussalam\0"
+  "Bulgaria\0"
+  "Burkina Faso\0"
+  "Burundi\0"
+  "Cabo Verde\0"
+  "Camboya\0"
+  "Camerún\0"
+  "Canadá\0"
+  "Islas Caimán\0"
+  "República Centroafricana\0"
+  "Chad\0"
+  "Chile\0"
+  "China\0"
+  "China, región administrativa especial de Hong Kong\0"
+  "China, región administrativa especial de Macao\0"
+  "Isla Christmas\0"
+  "Islas Cocos (Keeling)\0"
+  "Colombia\0"
+  "Comoras\0"
+  "Congo\0"
+  "Islas Cook\0"
+  "Costa Rica\0"
+  "Côte d’Ivoire\0"
+  "Croacia\0"
+  "Cuba\0"
+  "Curazao\0"
+  "Chipre\0"
+  "Chequia\0"
+  "República Popular Democrática de Corea\0"
+  "República Democrática del Congo\0"
+  "Dinamarca\0"
+  "Djibouti\0"
+  "Dominica\0"
+  "República Dominicana\0"
+  "Ecuador\0"
+  "Egipto\0"
+  "El Salvador\0"
+  "Guinea Ecuatorial\0"
+  "Eritrea\0"
+  "Estonia\0"
+  "Eswatini\0"
+  "Etiopía\0"
+  "Islas Malvinas (Falkland)\0"
+  "Islas Feroe\0"
+  "Fiji\0"
+  "Finlandia\0"
+  "Francia\0"
+  "Guayana Francesa\0"
+  "Polinesia Francesa\0"
+  "Territorio de las Tierras Australes Francesas\0"
+  "Gabón\0"
+  "Gambia\0"
+  "Georgia\0"
+  "Alemania\0"
+  "Ghana\0"
+  "Gibraltar\0"
+  "Grecia\0"
+  "Groenlandia\0"
+  "Granada\0"
+  "Guadalupe\0"
+  "Guam\0"
+  "Guatemala\0"
+  "Guernsey\0"
+  "Guinea\0"
+  "Guinea-Bissau\0"
+  "Guyana\0"
+  "Haití\0"
+  "Islas Heard y McDonald\0"
+  "Santa Sede\0"
+  "Honduras\0"
+  "Hungría\0"
+  "Islandia\0"
+  "India\0"
+  "Indonesia\0"
+  "Irán (República Islámica del)\0"
+  "Iraq\0"
+  "Irlanda\0"
+  "Isla de Man\0"
+  "Israel\0"
+  "Italia\0"
+  "Jamaica\0"
+  "Japón\0"
+  "Jersey\0"
+  "Jordania\0"
+  "Kazajstán\0"
+  "Kenya\0"
+  "Kiribati\0"
+  "Kuwait\0"
+  "Kirguistán\0"
+  "República Democrática Popular Lao\0"
+  "Letonia\0"
+  "Líbano\0"
+  "Liberia\0"
+  "Lesotho\0"
+  "Libia\0"
+  "Liechtenstein\0"
+  "Lituania\0"
+  "Luxemburgo\0"
+  "Madagascar\0"
+  "Malawi\0"
+  "Malasia\0"
+  "Maldivas\0"
+  "Malí\0"
+  "Malta\0"
+  "Islas Marshall\0"
+  "Martinica\0"
+  "Mauritania\0"
+  "Mauricio\0"
+  "Mayotte\0"
+  "México\0"
+  "Micronesia (Estados Federados de)\0"
+  "Mónaco\0"
+  "Mongolia\0"
+  "Montenegro\0"
+  "Montserrat\0"
+  "Marruecos\0"
+  "Mozambique\0"
+  "Myanmar\0"
+  "Namibia\0"
+  "Nauru\0"
+  "Nepal\0"
+  "Países Bajos\0"
+  "Nueva Caledonia\0"
+  "Nueva Zelandia\0"
+  "Nicaragua\0"
+  "Níger\0"
+  "Nigeria\0"
+  "Niue\0"
+  "Isla Norfolk\0"
+  "Macedonia del Norte\0"
+  "Islas Marianas Septentrionales\0"
+  "Noruega\0"
+  "Omán\0"
+  "Pakistán\0"
+  "Palau\0"
+  "Panamá\0"
+  "Papua Nueva Guinea\0"
+  "Paraguay\0"
+  "Perú\0"
+  "Pitcairn\0"
+  "Filipinas\0"
+  "Polonia\0"
+  "Portugal\0"
+  "Puerto Rico\0"
+  "Qatar\0"
+  "República de Corea\0"
+  "República de Moldova\0"
+  "Reunión\0"
+  "Rumania\0"
+  "Federación de Rusia\0"
+  "Rwanda\0"
+  "San Barthélemy\0"
+  "Santa Elena\0"
+  "Saint Kitts y Nevis\0"
+  "Santa Lucía\0"
+  "San Martín (parte francesa)\0"
+  "San Pedro y Miquelón\0"
+  "San Vicente y las Granadinas\0"
+  "Samoa\0"
+  "San Marino\0"
+  "Santo Tomé y Príncipe\0"
+  "Sark\0"
+  "Arabia Saudita\0"
+  "Senegal\0"
+  "Serbia\0"
+  "Seychelles\0"
+  "Sierra Leona\0"
+  "Singapur\0"
+  "San Martín (parte Holandesa)\0"
+  "Eslovaquia\0"
+  "Eslovenia\0"
+  "Islas Salomón\0"
+  "Somalia\0"
+  "Sudáfrica\0"
+  "Georgia del Sur y las Islas Sandwich del Sur\0"
+  "Sudán del Sur\0"
+  "España\0"
+  "Sri Lanka\0"
+  "Estado de Palestina\0"
+  "Sudán\0"
+  "Suriname\0"
+  "Islas Svalbard y Jan Mayen\0"
+  "Suecia\0"
+  "Suiza\0"
+  "República Árabe Siria\0"
+  "Tayikistán\0"
+  "Tailandia\0"
+  "Timor-Leste\0"
+  "Togo\0"
+  "Tokelau\0"
+  "Tonga\0"
+  "Trinidad y Tabago\0"
+  "Túnez\0"
+  "Turquía\0"
+  "Turkmenistán\0"
+  "Islas Turcas y Caicos\0"
+  "Tuvalu\0"
+  "Uganda\0"
+  "Ucrania\0"
+  "Emiratos Árabes Unidos\0"
+  "Reino Unido de Gran Bretaña e Irlanda del Norte\0"
+  "República Unida de Tanzanía\0"
+  "Islas menores alejadas de Estados Unidos\0"
+  "Estados Unidos de América\0"
+  "Islas Vírgenes de los Estados Unidos\0"
+  "Uruguay\0"
+  "Uzbekistán\0"
+  "Vanuatu\0"
+  "Venezuela (República Bolivariana de)\0"
+  "Viet Nam\0"
+  "Islas Wallis y Futuna\0"
+  "Sáhara Occidental\0"
+  "Yemen\0"
+  "Zambia\0"
+  "Zimbabwe\0";
+
+//! The Arabic names, one per M49 entry.
+constexpr char ARABIC_NAMES[] =
+  "أفغانستان\0"
+  "جزر ألاند\0"
+  "ألبانيا\0"
+  "الجزائر\0"
+  "ساموا الأمريكية\0"
+  "أندورا\0"
+  "أنغولا\0"
+  "أنغويلا\0"
+  "أنتاركتيكا\0"
+  "أنتيغوا وبربودا\0"
+  "الأرجنتين\0"
+  "أرمينيا\0"
+  "أروبا\0"
+  "أستراليا\0"
+  "النمسا\0"
+  "أذربيجان\0"
+  "جزر البهاما\0"
+  "البحرين\0"
+  "بنغلاديش\0"
+  "بربادوس\0"
+  "بيلاروس\0"
+  "بلجيكا\0"
+  "بليز\0"
+  "بنن\0"
+  "برمودا\0"
+  "بوتان\0"
+  "بوليفيا (دولة - المتعددة القوميات)\0"
+  "بونير وسانت يوستاشيوس وسابا\0"
+  "البوسنة والهرسك\0"
+  "بوتسوانا\0"
+  "جزيرة بوفيت\0"
+  "البرازيل\0"
+  "المحيط الهندي الإقليم البريطاني في\0"
+  "جزر فرجن البريطانية\0"
+  "بروني دار السلام\0"
+  "بلغاريا\0"
+  "بوركينا فاسو\0"
+  "بوروندي\0"
+  "كابو فيردي\0"
+  "كمبوديا\0"
+  "الكاميرون\0"
+  "كندا\0"
+  "جزر كايمان\0"
+  "جمهورية أفريقيا الوسطى\0"
+  "تشاد\0"
+  "شيلي\0"
+  "الصين\0"
+  "الصين، منطقة هونغ كونغ الإدارية الخاصة\0"
+  "الصين، منطقة ماكاو الإدارية الخاصة\0"
+  "جزيرة عيد الميلاد\0"
+  "جزر كوكس (كيلينغ)\0"
+  "كولومبيا\0"
+  "جزر القمر\0"
+  "الكونغو\0"
+  "جزر كوك\0"
+  "كوستاريكا\0"
+  "كوت ديفوار\0"
+  "كرواتيا\0"
+  "كوبا\0"
+  "كوراساو\0"
+  "قبرص\0"
+  "تشيكيا\0"
+  "جمهورية كوريا الشعبية الديمقراطية\0"
+  "جمهورية الكونغو الديمقراطية\0"
+  "الدانمرك\0"
+  "جيبوتي\0"
+  "دومينيكا\0"
+  "الجمهورية الدومينيكية\0"
+  "إكوادور\0"
+  "مصر\0"
+  "السلفادور\0"
+  "غينيا الاستوائية\0"
+  "إريتريا\0"
+  "إستونيا\0"
+  "إسواتيني\0"
+  "إثيوبيا\0"
+  "جزر فوكلاند (مالفيناس)\0"
+  "جزر فايرو\0"
+  "فيجي\0"
+  "فنلندا\0"
+  "فرنسا\0"
+  "غيانا الفرنسية\0"
+  "بولينيزيا الفرنسية\0"
+  "الأراضي الفرنسية الجنوبية الجنوبية\0"
+  "غابون\0"
+  "غامبيا\0"
+  "جورجيا\0"
+  "ألمانيا\0"
+  "غانا\0"
+  "جبل طارق\0"
+  "اليونان\0"
+  "غرينلند\0"
+  "غرينادا\0"
+  "غوادلوب\0"
+  "غوام\0"
+  "غواتيمالا\0"
+  "غيرنسي\0"
+  "غينيا\0"
+  "غينيا - بيساو\0"
+  "غيانا\0"
+  "هايتي\0"
+  "جزيرة هيرد وجزر ماكدونالد\0"
+  "الكرسي الرسولي\0"
+  "هندوراس\0"
+  "هنغاريا\0"
+  "آيسلندا\0"
+  "الهند\0"
+  "إندونيسيا\0"
+  "إيران (جمهورية - الإسلامية)\0"
+  "العراق\0"
+  "آيرلندا\0"
+  "جزيرة مان\0"
+  "إسرائيل\0"
+  "إيطاليا\0"
+  "جامايكا\0"
+  "اليابان\0"
+  "جيرسي\0"
+  "الأردن\0"
+  "كازاخستان\0"
+  "كينيا\0"
+  "كيريباس\0"
+  "الكويت\0"
+  "قيرغيزستان\0"
+  "جمهورية لاو الديمقراطية الشعبية\0"
+  "لاتفيا\0"
+  "لبنان\0"
+  "ليبيريا\0"
+  "ليسوتو\0"
+  "ليبيا\0"
+  "ليختنشتاين\0"
+  "ليتوانيا\0"
+  "لكسمبرغ\0"
+  "مدغشقر\0"
+  "ملاوي\0"
+  "ماليزيا\0"
+  "ملديف\0"
+  "مالي\0"
+  "مالطة\0"
+  "جزر مارشال\0"
+  "مارتينيك\0"
+  "موريتانيا\0"
+  "موريشيوس\0"
+  "مايوت\0"
+  "المكسيك\0"
+  "ميكرونيزيا (ولايات - الموحدة)\0"
+  "موناكو\0"
+  "منغوليا\0"
+  "الجبل الأسود\0"
+  "مونتسيرات\0"
+  "المغرب\0"
+  "موزامبيق\0"
+  "ميانمار\0"
+  "ناميبيا\0"
+  "ناورو\0"
+  "نيبال\0"
+  "هولندا\0"
+  "كاليدونيا الجديدة\0"
+  "نيوزيلندا\0"
+  "نيكاراغوا\0"
+  "النيجر\0"
+  "نيجيريا\0"
+  "نيوي\0"
+  "جزيرة نورفولك\0"
+  "مقدونيا الشمالية\0"
+  "جزر ماريانا الشمالية\0"
+  "النرويج\0"
+  "عمان\0"
+  "باكستان\0"
+  "بالاو\0"
+  "بنما\0"
+  "بابوا غينيا الجديدة\0"
+  "باراغواي\0"
+  "بيرو\0"
+  "بيتكرن\0"
+  "الفلبين\0"
+  "بولندا\0"
+  "البرتغال\0"
+  "بورتوريكو\0"
+  "قطر\0"
+  "جمهورية كوريا\0"
+  "جمهورية مولدوفا\0"
+  "ريونيون\0"
+  "رومانيا\0"
+  "الاتحاد الروسي\0"
+  "رواندا\0"
+  "سان بارتليمي\0"
+  "سانت هيلانة\0"
+  "سانت كيتس ونيفس\0"
+  "سانت لوسيا\0"
+  "سانت مارتن (الجزء الفرنسي)\0"
+  "سان بيير وميكلون\0"
+  "سانت فنسنت وجزر غرينادين\0"
+  "ساموا\0"
+  "سان مارينو\0"
+  "سان تومي وبرينسيبي\0"
+  "سارك\0"
+  "المملكة العربية السعودية\0"
+  "السنغال\0"
+  "صربيا\0"
+  "سيشيل\0"
+  "سيراليون\0"
+  "سنغافورة\0"
+  "سانت مارتن (الجزء الهولندي)\0"
+  "سلوفاكيا\0"
+  "سلوفينيا\0"
+  "جزر سليمان\0"
+  "الصومال\0"
+  "جنوب أفريقيا\0"
+  "جورجيا الجنوبية وجزر ساندويتش الجنوبية\0"
+  "جنوب السودان\0"
+  "إسبانيا\0"
+  "سري لانكا\0"
+  "دولة فلسطين\0"
+  "السودان\0"
+  "سورينام\0"
+  "جزيرتي سفالبارد وجان مايِن\0"
+  "السويد\0"
+  "سويسرا\0"
+  "الجمهورية العربية السورية\0"
+  "طاجيكستان\0"
+  "تايلند\0"
+  "تيمور - ليشتي\0"
+  "توغو\0"
+  "توكيلاو\0"
+  "تونغا\0"
+  "ترينيداد وتوباغو\0"
+  "تونس\0"
+  "تركيا\0"
+  "تركمانستان\0"
+  "جزر تركس وكايكوس\0"
+  "توفالو\0"
+  "أوغندا\0"
+  "أوكرانيا\0"
+  "الإمارات العربية المتحدة\0"
+  "المملكة المتحدة لبريطانيا العظمى وآيرلندا الشمالية\0"
+  "جمهورية تنزانيا المتحدة\0"
+  "نائية التابعة للولايات المتحدة\0"
+  "الولايات المتحدة الأمريكية\0"
+  "جزر فرجن التابعة للولايات المتحدة\0"
+  "أوروغواي\0"
+  "أوزبكستان\0"
+  "فانواتو\0"
+  "فنزويلا (جمهورية - البوليفارية)\0"
+  "فييت نام\0"
+  "جزر واليس وفوتونا\0"
+  "الصحراء الغربية\0"
+  "اليمن\0"
+  "زامبيا\0"
+  "زمبابوي\0";
+
+// clang-format on
+/*!
+  \brief A link from a M49 country, area or region to the region that contains
+  it.
+ */
+struct M49Link
+{
+  std::uint16_t code;   //!< The M49 code of the country, area or region.
+  std::uint16_t region; //!< The M49 code of the containing region.
+};
+
+//! \brief The M49 regions, each with the region that immediately contains it.
+//!
+//! The World (001) is the root and has a region of 0. North America (003) is
+//! not part of the current M49 tree but is still used by the IANA registry, so
+//! it is kept with its members listed in GROUPINGS.
+constexpr M49Link REGIONS[] = {
+  { 1, 0 },     // World
+  { 2, 1 },     // Africa
+  { 15, 2 },    // Northern Africa
+  { 202, 2 },   // Sub-Saharan Africa
+  { 14, 202 },  // Eastern Africa
+  { 17, 202 },  // Middle Africa
+  { 18, 202 },  // Southern Africa
+  { 11, 202 },  // Western Africa
+  { 19, 1 },    // Americas
+  { 419, 19 },  // Latin America and the Caribbean
+  { 29, 419 },  // Caribbean
+  { 13, 419 },  // Central America
+  { 5, 419 },   // South America
+  { 21, 19 },   // Northern America
+  { 3, 19 },    // North America
+  { 142, 1 },   // Asia
+  { 143, 142 }, // Central Asia
+  { 30, 142 },  // Eastern Asia
+  { 35, 142 },  // South-eastern Asia
+  { 34, 142 },  // Southern Asia
+  { 145, 142 }, // Western Asia
+  { 150, 1 },   // Europe
+  { 151, 150 }, // Eastern Europe
+  { 154, 150 }, // Northern Europe
+  { 830, 154 }, // Channel Islands
+  { 39, 150 },  // Southern Europe
+  { 155, 150 }, // Western Europe
+  { 9, 1 },     // Oceania
+  { 53, 9 },    // Australia and New Zealand
+  { 54, 9 },    // Melanesia
+  { 57, 9 },    // Micronesia
+  { 61, 9 },    // Polynesia
+};
+
+//! \brief Regions that overlap the M49 tree, each with a member region.
+constexpr M49Link GROUPINGS[] = {
+  { 21, 3 },    // Northern America
+  { 13, 3 },    // Central America
+  { 29, 3 },    // Caribbean
+};
+
+//! \brief The region that immediately contains each country or area in M49.
+constexpr M49Link AREAS[] = {
+  // Northern Africa
+  { 12, 15 },   // Algeria
+  { 818, 15 },  // Egypt
+  { 434, 15 },  // Libya
+  { 504, 15 },  // Morocco
+  { 729, 15 },  // Sudan
+  { 788, 15 },  // Tunisia
+  { 732, 15 },  // Western Sahara
+
+  // Eastern Africa
+  { 86, 14 },   // British Indian Ocean Territory
+  { 108, 14 },  // Burundi
+  { 174, 14 },  // Comoros
+  { 262, 14 },  // Djibouti
+  { 232, 14 },  // Eritrea
+  { 231, 14 },  // Ethiopia
+  { 260, 14 },  // French Southern Territories
+  { 404, 14 },  // Kenya
+  { 450, 14 },  // Madagascar
+  { 454, 14 },  // Malawi
+  { 480, 14 },  // Mauritius
+  { 175, 14 },  // Mayotte
+  { 508, 14 },  // Mozambique
+  { 638, 14 },  // Réunion
+  { 646, 14 },  // Rwanda
+  { 690, 14 },  // Seychelles
+  { 706, 14 },  // Somalia
+  { 728, 14 },  // South Sudan
+  { 800, 14 },  // Uganda
+  { 834, 14 },  // United Republic of Tanzania
+  { 894, 14 },  // Zambia
+  { 716, 14 },  // Zimbabwe
+
+  // Middle Africa
+  { 24, 17 },   // Angola
+  { 120, 17 },  // Cameroon
+  { 140, 17 },  // Central African Republic
+  { 148, 17 },  // Chad
+  { 178, 17 },  // Congo
+  { 180, 17 },  // Democratic Republic of the Congo
+  { 226, 17 },  // Equatorial Guinea
+  { 266, 17 },  // Gabon
+  { 678, 17 },  // Sao Tome and Principe
+
+  // Southern Africa
+  { 72, 18 },   // Botswana
+  { 748, 18 },  // Eswatini
+  { 426, 18 },  // Lesotho
+  { 516, 18 },  // Namibia
+  { 710, 18 },  // South Africa
+
+  // Western Africa
+  { 204, 11 },  // Benin
+  { 854, 11 },  // Burkina Faso
+  { 132, 11 },  // Cabo Verde
+  { 384, 11 },  // Côte d’Ivoire
+  { 270, 11 },  // Gambia
+  { 288, 11 },  // Ghana
+  { 324, 11 },  // Guinea
+  { 624, 11 },  // Guinea-Bissau
+  { 430, 11 },  // Liberia
+  { 466, 11 },  // Mali
+  { 478, 11 },  // Mauritania
+  { 562, 11 },  // Niger
+  { 566, 11 },  // Nigeria
+  { 654, 11 },  // Saint Helena
+  { 686, 11 },  // Senegal
+  { 694, 11 },  // Sierra Leone
+  { 768, 11 },  // Togo
+
+  // Caribbean
+  { 660, 29 },  // Anguilla
+  { 28, 29 },   // Antigua and Barbuda
+  { 533, 29 },  // Aruba
+  { 44, 29 },   // Bahamas
+  { 52, 29 },   // Barbados
+  { 535, 29 },  // Bonaire, Sint Eustatius and Saba
+  { 92, 29 },   // British Virgin Islands
+  { 136, 29 },  // Cayman Islands
+  { 192, 29 },  // Cuba
+  { 531, 29 },  // Curaçao
+  { 212, 29 },  // Dominica
+  { 214, 29 },  // Dominican Republic
+  { 308, 29 },  // Grenada
+  { 312, 29 },  // Guadeloupe
+  { 332, 29 },  // Haiti
+  { 388, 29 },  // Jamaica
+  { 474, 29 },  // Martinique
+  { 500, 29 },  // Montserrat
+  { 630, 29 },  // Puerto Rico
+  { 652, 29 },  // Saint Barthélemy
+  { 659, 29 },  // Saint Kitts and Nevis
+  { 662, 29 },  // Saint Lucia
+  { 663, 29 },  // Saint Martin (French Part)
+  { 670, 29 },  // Saint Vincent and the Grenadines
+  { 534, 29 },  // Sint Maarten (Dutch part)
+  { 780, 29 },  // Trinidad and Tobago
+  { 796, 29 },  // Turks and Caicos Islands
+  { 850, 29 },  // United States Virgin Islands
+
+  // Central America
+  { 84, 13 },   // Belize
+  { 188, 13 },  // Costa Rica
+  { 222, 13 },  // El Salvador
+  { 320, 13 },  // Guatemala
+  { 340, 13 },  // Honduras
+  { 484, 13 },  // Mexico
+  { 558, 13 },  // Nicaragua
+  { 591, 13 },  // Panama
+
+  // South America
+  { 32, 5 },    // Argentina
+  { 68, 5 },    // Bolivia (Plurinational State of)
+  { 74, 5 },    // Bouvet Island
+  { 76, 5 },    // Brazil
+  { 152, 5 },   // Chile
+  { 170, 5 },   // Colombia
+  { 218, 5 },   // Ecuador
+  { 238, 5 },   // Falkland Islands (Malvinas)
+  { 254, 5 },   // French Guiana
+  { 328, 5 },   // Guyana
+  { 600, 5 },   // Paraguay
+  { 604, 5 },   // Peru
+  { 239, 5 },   // South Georgia and the South Sandwich Islands
+  { 740, 5 },   // Suriname
+  { 858, 5 },   // Uruguay
+  { 862, 5 },   // Venezuela (Bolivarian Republic of)
+
+  // Northern America
+  { 60, 21 },   // Bermuda
+  { 124, 21 },  // Canada
+  { 304, 21 },  // Greenland
+  { 666, 21 },  // Saint Pierre and Miquelon
+  { 840, 21 },  // United States of America
+
+  // Central Asia
+  { 398, 143 }, // Kazakhstan
+  { 417, 143 }, // Kyrgyzstan
+  { 762, 143 }, // Tajikistan
+  { 795, 143 }, // Turkmenistan
+  { 860, 143 }, // Uzbekistan
+
+  // Eastern Asia
+  { 156, 30 },  // China
+  { 344, 30 },  // China, Hong Kong Special Administrative Region
+  { 446, 30 },  // China, Macao Special Administrative Region
+  { 408, 30 },  // Democratic People's Republic of Korea
+  { 392, 30 },  // Japan
+  { 496, 30 },  // Mongolia
+  { 410, 30 },  // Republic of Korea
+
+  // South-eastern Asia
+  { 96, 35 },   // Brunei Darussalam
+  { 116, 35 },  // Cambodia
+  { 360, 35 },  // Indonesia
+  { 418, 35 },  // Lao People's Democratic Republic
+  { 458, 35 },  // Malaysia
+  { 104, 35 },  // Myanmar
+  { 608, 35 },  // Philippines
+  { 702, 35 },  // Singapore
+  { 764, 35 },  // Thailand
+  { 626, 35 },  // Timor-Leste
+  { 704, 35 },  // Viet Nam
+
+  // Southern Asia
+  { 4, 34 },    // Afghanistan
+  { 50, 34 },   // Bangladesh
+  { 64, 34 },   // Bhutan
+  { 356, 34 },  // India
+  { 364, 34 },  // Iran (Islamic Republic of)
+  { 462, 34 },  // Maldives
+  { 524, 34 },  // Nepal
+  { 586, 34 },  // Pakistan
+  { 144, 34 },  // Sri Lanka
+
+  // Western Asia
+  { 51, 145 },  // Armenia
+  { 31, 145 },  // Azerbaijan
+  { 48, 145 },  // Bahrain
+  { 196, 145 }, // Cyprus
+  { 268, 145 }, // Georgia
+  { 368, 145 }, // Iraq
+  { 376, 145 }, // Israel
+  { 400, 145 }, // Jordan
+  { 414, 145 }, // Kuwait
+  { 422, 145 }, // Lebanon
+  { 512, 145 }, // Oman
+  { 634, 145 }, // Qatar
+  { 682, 145 }, // Saudi Arabia
+  { 275, 145 }, // State of Palestine
+  { 760, 145 }, // Syrian Arab Republic
+  { 792, 145 }, // Turkey
+  { 784, 145 }, // United Arab Emirates
+  { 887, 145 }, // Yemen
+
+  // Eastern Europe
+  { 112, 151 }, // Belarus
+  { 100, 151 }, // Bulgaria
+  { 203, 151 }, // Czechia
+  { 348, 151 }, // Hungary
+  { 616, 151 }, // Poland
+  { 498, 151 }, // Republic of Moldova
+  { 642, 151 }, // Romania
+  { 643, 151 }, // Russian Federation
+  { 703, 151 }, // Slovakia
+  { 804, 151 }, // Ukraine
+
+  // Northern Europe
+  { 248, 154 }, // Åland Islands
+  { 208, 154 }, // Denmark
+  { 233, 154 }, // Estonia
+  { 234, 154 }, // Faroe Islands
+  { 246, 154 }, // Finland
+  { 352, 154 }, // Iceland
+  { 372, 154 }, // Ireland
+  { 833, 154 }, // Isle of Man
+  { 428, 154 }, // Latvia
+  { 440, 154 }, // Lithuania
+  { 578, 154 }, // Norway
+  { 744, 154 }, // Svalbard and Jan Mayen Islands
+  { 752, 154 }, // Sweden
+  { 826, 154 }, // United Kingdom of Great Britain and Northern Ireland
+
+  // Channel Islands
+  { 831, 830 }, // Guernsey
+  { 832, 830 }, // Jersey
+  { 680, 830 }, // Sark
+
+  // Southern Europe
+  { 8, 39 },    // Albania
+  { 20, 39 },   // Andorra
+  { 70, 39 },   // Bosnia and Herzegovina
+  { 191, 39 },  // Croatia
+  { 292, 39 },  // Gibraltar
+  { 300, 39 },  // Greece
+  { 336, 39 },  // Holy See
+  { 380, 39 },  // Italy
+  { 470, 39 },  // Malta
+  { 499, 39 },  // Montenegro
+  { 807, 39 },  // North Macedonia
+  { 620, 39 },  // Portugal
+  { 674, 39 },  // San Marino
+  { 688, 39 },  // Serbia
+  { 705, 39 },  // Slovenia
+  { 724, 39 },  // Spain
+
+  // Western Europe
+  { 40, 155 },  // Austria
+  { 56, 155 },  // Belgium
+  { 250, 155 }, // France
+  { 276, 155 }, // Germany
+  { 438, 155 }, // Liechtenstein
+  { 442, 155 }, // Luxembourg
+  { 492, 155 }, // Monaco
+  { 528, 155 }, // Netherlands
+  { 756, 155 }, // Switzerland
+
+  // Australia and New Zealand
+  { 36, 53 },   // Australia
+  { 162, 53 },  // Christmas Island
+  { 166, 53 },  // Cocos (Keeling) Islands
+  { 334, 53 },  // Heard Island and McDonald Islands
+  { 554, 53 },  // New Zealand
+  { 574, 53 },  // Norfolk Island
+
+  // Melanesia
+  { 242, 54 },  // Fiji
+  { 540, 54 },  // New Caledonia
+  { 598, 54 },  // Papua New Guinea
+  { 90, 54 },   // Solomon Islands
+  { 548, 54 },  // Vanuatu
+
+  // Micronesia
+  { 316, 57 },  // Guam
+  { 296, 57 },  // Kiribati
+  { 584, 57 },  // Marshall Islands
+  { 583, 57 },  // Micronesia (Federated States of)
+  { 520, 57 },  // Nauru
+  { 580, 57 },  // Northern Mariana Islands
+  { 585, 57 },  // Palau
+  { 581, 57 },  // United States Minor Outlying Islands
+
+  // Polynesia
+  { 16, 61 },   // American Samoa
+  { 184, 61 },  // Cook Islands
+  { 258, 61 },  // French Polynesia
+  { 570, 61 },  // Niue
+  { 612, 61 },  // Pitcairn
+  { 882, 61 },  // Samoa
+  { 772, 61 },  // Tokelau
+  { 776, 61 },  // Tonga
+  { 798, 61 },  // Tuvalu
+  { 876, 61 },  // Wallis and Futuna Islands
+
+  // World
+  { 10, 1 },    // Antarctica
+};
+
+/*!
+  \brief An ISO 3166-1 alpha-2 code with its numeric code, which is also the
+  M49 code of the country or area.
+ */
+struct Alpha2Code
+{
+  char code[3];      //!< The alpha-2 code.
+  std::uint16_t m49; //!< The numeric code.
+};
+
+//! \brief The ISO 3166-1 alpha-2 codes, in code order.
+//!
+//! BCP47 alphabetic region subtags are these codes, so they are joined to M49
+//! through this table rather than by name, as the IANA and UN names often
+//! differ ("United States" and "United States of America"). Taiwan (158) has
+//! an ISO code but no entry in the M49 table.
+constexpr Alpha2Code ALPHA2_CODES[] = {
+  { "AD", 20 },   // Andorra
+  { "AE", 784 },  // United Arab Emirates
+  { "AF", 4 },    // Afghanistan
+  { "AG", 28 },   // Antigua and Barbuda
+  { "AI", 660 },  // Anguilla
+  { "AL", 8 },    // Albania
+  { "AM", 51 },   // Armenia
+  { "AO", 24 },   // Angola
+  { "AQ", 10 },   // Antarctica
+  { "AR", 32 },   // Argentina
+  { "AS", 16 },   // American Samoa
+  { "AT", 40 },   // Austria
+  { "AU", 36 },   // Australia
+  { "AW", 533 },  // Aruba
+  { "AX", 248 },  // Åland Islands
+  { "AZ", 31 },   // Azerbaijan
+  { "BA", 70 },   // Bosnia and Herzegovina
+  { "BB", 52 },   // Barbados
+  { "BD", 50 },   // Bangladesh
+  { "BE", 56 },   // Belgium
+  { "BF", 854 },  // Burkina Faso
+  { "BG", 100 },  // Bulgaria
+  { "BH", 48 },   // Bahrain
+  { "BI", 108 },  // Burundi
+  { "BJ", 204 },  // Benin
+  { "BL", 652 },  // Saint Barthélemy
+  { "BM", 60 },   // Bermuda
+  { "BN", 96 },   // Brunei Darussalam
+  { "BO", 68 },   // Bolivia, Plurinational State of
+  { "BQ", 535 },  // Bonaire, Sint Eustatius and Saba
+  { "BR", 76 },   // Brazil
+  { "BS", 44 },   // Bahamas
+  { "BT", 64 },   // Bhutan
+  { "BV", 74 },   // Bouvet Island
+  { "BW", 72 },   // Botswana
+  { "BY", 112 },  // Belarus
+  { "BZ", 84 },   // Belize
+  { "CA", 124 },  // Canada
+  { "CC", 166 },  // Cocos (Keeling) Islands
+  { "CD", 180 },  // Congo, The Democratic Republic of the
+  { "CF", 140 },  // Central African Republic
+  { "CG", 178 },  // Congo
+  { "CH", 756 },  // Switzerland
+  { "CI", 384 },  // Côte d'Ivoire
+  { "CK", 184 },  // Cook Islands
+  { "CL", 152 },  // Chile
+  { "CM", 120 },  // Cameroon
+  { "CN", 156 },  // China
+  { "CO", 170 },  // Colombia
+  { "CR", 188 },  // Costa Rica
+  { "CU", 192 },  // Cuba
+  { "CV", 132 },  // Cabo Verde
+  { "CW", 531 },  // Curaçao
+  { "CX", 162 },  // Christmas Island
+  { "CY", 196 },  // Cyprus
+  { "CZ", 203 },  // Czechia
+  { "DE", 276 },  // Germany
+  { "DJ", 262 },  // Djibouti
+  { "DK", 208 },  // Denmark
+  { "DM", 212 },  // Dominica
+  { "DO", 214 },  // Dominican Republic
+  { "DZ", 12 },   // Algeria
+  { "EC", 218 },  // Ecuador
+  { "EE", 233 },  // Estonia
+  { "EG", 818 },  // Egypt
+  { "EH", 732 },  // Western Sahara
+  { "ER", 232 },  // Eritrea
+  { "ES", 724 },  // Spain
+  { "ET", 231 },  // Ethiopia
+  { "FI", 246 },  // Finland
+  { "FJ", 242 },  // Fiji
+  { "FK", 238 },  // Falkland Islands (Malvinas)
+  { "FM", 583 },  // Micronesia, Federated States of
+  { "FO", 234 },  // Faroe Islands
+  { "FR", 250 },  // France
+  { "GA", 266 },  // Gabon
+  { "GB", 826 },  // United Kingdom
+  { "GD", 308 },  // Grenada
+  { "GE", 268 },  // Georgia
+  { "GF", 254 },  // French Guiana
+  { "GG", 831 },  // Guernsey
+  { "GH", 288 },  // Ghana
+  { "GI", 292 },  // Gibraltar
+  { "GL", 304 },  // Greenland
+  { "GM", 270 },  // Gambia
+  { "GN", 324 },  // Guinea
+  { "GP", 312 },  // Guadeloupe
+  { "GQ", 226 },  // Equatorial Guinea
+  { "GR", 300 },  // Greece
+  { "GS", 239 },  // South Georgia and the South Sandwich Islands
+  { "GT", 320 },  // Guatemala
+  { "GU", 316 },  // Guam
+  { "GW", 624 },  // Guinea-Bissau
+  { "GY", 328 },  // Guyana
+  { "HK", 344 },  // Hong Kong
+  { "HM", 334 },  // Heard Island and McDonald Islands
+  { "HN", 340 },  // Honduras
+  { "HR", 191 },  // Croatia
+  { "HT", 332 },  // Haiti
+  { "HU", 348 },  // Hungary
+  { "ID", 360 },  // Indonesia
+  { "IE", 372 },  // Ireland
+  { "IL", 376 },  // Israel
+  { "IM", 833 },  // Isle of Man
+  { "IN", 356 },  // India
+  { "IO", 86 },   // British Indian Ocean Territory
+  { "IQ", 368 },  // Iraq
+  { "IR", 364 },  // Iran, Islamic Republic of
+  { "IS", 352 },  // Iceland
+  { "IT", 380 },  // Italy
+  { "JE", 832 },  // Jersey
+  { "JM", 388 },  // Jamaica
+  { "JO", 400 },  // Jordan
+  { "JP", 392 },  // Japan
+  { "KE", 404 },  // Kenya
+  { "KG", 417 },  // Kyrgyzstan
+  { "KH", 116 },  // Cambodia
+  { "KI", 296 },  // Kiribati
+  { "KM", 174 },  // Comoros
+  { "KN", 659 },  // Saint Kitts and Nevis
+  { "KP", 408 },  // Korea, Democratic People's Republic of
+  { "KR", 410 },  // Korea, Republic of
+  { "KW", 414 },  // Kuwait
+  { "KY", 136 },  // Cayman Islands
+  { "KZ", 398 },  // Kazakhstan
+  { "LA", 418 },  // Lao People's Democratic Republic
+  { "LB", 422 },  // Lebanon
+  { "LC", 662 },  // Saint Lucia
+  { "LI", 438 },  // Liechtenstein
+  { "LK", 144 },  // Sri Lanka
+  { "LR", 430 },  // Liberia
+  { "LS", 426 },  // Lesotho
+  { "LT", 440 },  // Lithuania
+  { "LU", 442 },  // Luxembourg
+  { "LV", 428 },  // Latvia
+  { "LY", 434 },  // Libya
+  { "MA", 504 },  // Morocco
+  { "MC", 492 },  // Monaco
+  { "MD", 498 },  // Moldova, Republic of
+  { "ME", 499 },  // Montenegro
+  { "MF", 663 },  // Saint Martin (French part)
+  { "MG", 450 },  // Madagascar
+  { "MH", 584 },  // Marshall Islands
+  { "MK", 807 },  // North Macedonia
+  { "ML", 466 },  // Mali
+  { "MM", 104 },  // Myanmar
+  { "MN", 496 },  // Mongolia
+  { "MO", 446 },  // Macao
+  { "MP", 580 },  // Northern Mariana Islands
+  { "MQ", 474 },  // Martinique
+  { "MR", 478 },  // Mauritania
+  { "MS", 500 },  // Montserrat
+  { "MT", 470 },  // Malta
+  { "MU", 480 },  // Mauritius
+  { "MV", 462 },  // Maldives
+  { "MW", 454 },  // Malawi
+  { "MX", 484 },  // Mexico
+  { "MY", 458 },  // Malaysia
+  { "MZ", 508 },  // Mozambique
+  { "NA", 516 },  // Namibia
+  { "NC", 540 },  // New Caledonia
+  { "NE", 562 },  // Niger
+  { "NF", 574 },  // Norfolk Island
+  { "NG", 566 },  // Nigeria
+  { "NI", 558 },  // Nicaragua
+  { "NL", 528 },  // Netherlands
+  { "NO", 578 },  // Norway
+  { "NP", 524 },  // Nepal
+  { "NR", 520 },  // Nauru
+  { "NU", 570 },  // Niue
+  { "NZ", 554 },  // New Zealand
+  { "OM", 512 },  // Oman
+  { "PA", 591 },  // Panama
+  { "PE", 604 },  // Peru
+  { "PF", 258 },  // French Polynesia
+  { "PG", 598 },  // Papua New Guinea
+  { "PH", 608 },  // Philippines
+  { "PK", 586 },  // Pakistan
+  { "PL", 616 },  // Poland
+  { "PM", 666 },  // Saint Pierre and Miquelon
+  { "PN", 612 },  // Pitcairn
+  { "PR", 630 },  // Puerto Rico
+  { "PS", 275 },  // Palestine, State of
+  { "PT", 620 },  // Portugal
+  { "PW", 585 },  // Palau
+  { "PY", 600 },  // Paraguay
+  { "QA", 634 },  // Qatar
+  { "RE", 638 },  // Réunion
+  { "RO", 642 },  // Romania
+  { "RS", 688 },  // Serbia
+  { "RU", 643 },  // Russian Federation
+  { "RW", 646 },  // Rwanda
+  { "SA", 682 },  // Saudi Arabia
+  { "SB", 90 },   // Solomon Islands
+  { "SC", 690 },  // Seychelles
+  { "SD", 729 },  // Sudan
+  { "SE", 752 },  // Sweden
+  { "SG", 702 },  // Singapore
+  { "SH", 654 },  // Saint Helena, Ascension and Tristan da Cunha
+  { "SI", 705 },  // Slovenia
+  { "SJ", 744 },  // Svalbard and Jan Mayen
+  { "SK", 703 },  // Slovakia
+  { "SL", 694 },  // Sierra Leone
+  { "SM", 674 },  // San Marino
+  { "SN", 686 },  // Senegal
+  { "SO", 706 },  // Somalia
+  { "SR", 740 },  // Suriname
+  { "SS", 728 },  // South Sudan
+  { "ST", 678 },  // Sao Tome and Principe
+  { "SV", 222 },  // El Salvador
+  { "SX", 534 },  // Sint Maarten (Dutch part)
+  { "SY", 760 },  // Syrian Arab Republic
+  { "SZ", 748 },  // Eswatini
+  { "TC", 796 },  // Turks and Caicos Islands
+  { "TD", 148 },  // Chad
+  { "TF", 260 },  // French Southern Territories
+  { "TG", 768 },  // Togo
+  { "TH", 764 },  // Thailand
+  { "TJ", 762 },  // Tajikistan
+  { "TK", 772 },  // Tokelau
+  { "TL", 626 },  // Timor-Leste
+  { "TM", 795 },  // Turkmenistan
+  { "TN", 788 },  // Tunisia
+  { "TO", 776 },  // Tonga
+  { "TR", 792 },  // Türkiye
+  { "TT", 780 },  // Trinidad and Tobago
+  { "TV", 798 },  // Tuvalu
+  { "TW", 158 },  // Taiwan, Province of China
+  { "TZ", 834 },  // Tanzania, United Republic of
+  { "UA", 804 },  // Ukraine
+  { "UG", 800 },  // Uganda
+  { "UM", 581 },  // United States Minor Outlying Islands
+  { "US", 840 },  // United States
+  { "UY", 858 },  // Uruguay
+  { "UZ", 860 },  // Uzbekistan
+  { "VA", 336 },  // Holy See (Vatican City State)
+  { "VC", 670 },  // Saint Vincent and the Grenadines
+  { "VE", 862 },  // Venezuela, Bolivarian Republic of
+  { "VG", 92 },   // Virgin Islands, British
+  { "VI", 850 },  // Virgin Islands, U.S.
+  { "VN", 704 },  // Viet Nam
+  { "VU", 548 },  // Vanuatu
+  { "WF", 876 },  // Wallis and Futuna
+  { "WS", 882 },  // Samoa
+  { "YE", 887 },  // Yemen
+  { "YT", 175 },  // Mayotte
+  { "ZA", 710 },  // South Africa
+  { "ZM", 894 },  // Zambia
+  { "ZW", 716 },  // Zimbabwe
+};
+
+//! \brief Calculates the start offset of every NUL separated name within a
+//! name column.
+//!
+//! The final entry holds the total size of the column so that the length of
+//! name i is always offsets[i + 1] - offsets[i] - 1.
+template<std::size_t N>
+constexpr std::array<std::uint16_t, COUNT + 1>
+nameOffsets(const char (&names)[N])
+{
+  std::array<std::uint16_t, COUNT + 1> offsets{};
+  std::size_t index = 0;
+  offsets[0] = 0;
+  // the last character is the implicit terminating NUL of the literal.
+  for (std::size_t i = 0; i < N - 1 && index < COUNT; i++) {
+    if (names[i] == '\0') {
+      offsets[++index] = static_cast<std::uint16_t>(i + 1);
+    }
+  }
+  return offsets;
+}
+
+//! \brief Counts the NUL separated names in a name column.
+template<std::size_t N>
+constexpr std::size_t
+nameCount(const char (&names)[N])
+{
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < N - 1; i++) {
+    if (names[i] == '\0')
+      count++;
+  }
+  return count;
+}
+
+static_assert(nameCount(ENGLISH_NAMES) == COUNT,
+              "English name column does not match the M49 table");
+static_assert(nameCount(RUSSIAN_NAMES) == COUNT,
+              "Russian name column does not match the M49 table");
+static_assert(nameCount(CHINESE_NAMES) == COUNT,
+              "Chinese name column does not match the M49 table");
+static_assert(nameCount(FRENCH_NAMES) == COUNT,
+              "French name column does not match the M49 table");
+static_assert(nameCount(SPANISH_NAMES) == COUNT,
+              "Spanish name column does not match the M49 table");
+static_assert(nameCount(ARABIC_NAMES) == COUNT,
+              "Arabic name column does not match the M49 table");
+
+constexpr auto ENGLISH_OFFSETS = nameOffsets(ENGLISH_NAMES);
+constexpr auto RUSSIAN_OFFSETS = nameOffsets(RUSSIAN_NAMES);
+constexpr auto CHINESE_OFFSETS = nameOffsets(CHINESE_NAMES);
+constexpr auto FRENCH_OFFSETS = nameOffsets(FRENCH_NAMES);
+constexpr auto SPANISH_OFFSETS = nameOffsets(SPANISH_NAMES);
+constexpr auto ARABIC_OFFSETS = nameOffsets(ARABIC_NAMES);
+
+} // end of namespace UNStatisticalData
+/// \endcond DO_NOT_DOCUMENT
+
+#endif // UNSTATISTICALDATA_H
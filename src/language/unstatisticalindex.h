@@ -0,0 +1,722 @@
+#ifndef UNSTATISTICALINDEX_H
+#define UNSTATISTICALINDEX_H
+
+#include "language/unstatisticaldata.h"
+
+/// \cond DO_NOT_DOCUMENT
+/*!
+  \file unstatisticalindex.h
+  \brief Compile time name to M49 table indexes for UNStatisticalCodes.
+
+  Every name column in UNStatisticalData gets a minimal perfect hash built by
+  the compiler (a hash and displace table). A lookup hashes the UTF-16 units of
+  the QString, reads one displacement and one slot, and then does a single
+  compare against the stored UTF-8 name. No QString is ever created. A further
+  global table covers the names of all six languages at once.
+
+  Names are hashed as UTF-16 code units so that QString::utf16() can be hashed
+  directly without any conversion to UTF-8.
+
+  M49 codes are looked up through a direct index of all 1000 possible codes and
+  alpha-3 codes are packed into a single integer and found through a small
+  open addressed hash. The M49 region tree is held as direct indexes of parent
+  and ancestor bit sets so that containment is a single bit test.
+ */
+namespace UNStatisticalIndex {
+
+//! The largest bucket the perfect hash builder can handle.
+constexpr std::size_t MAX_BUCKET_SIZE = 32;
+//! The largest displacement the builder will try for a bucket.
+constexpr std::uint32_t MAX_DISPLACEMENT = 0xFFFF;
+//! An empty slot value.
+constexpr std::int16_t EMPTY = -1;
+
+//! \brief Decodes the next UTF-8 code point from value, starting at pos.
+//!
+//! pos is moved to the start of the following code point.
+constexpr char32_t
+decodeUtf8(const char* value, std::size_t size, std::size_t& pos)
+{
+  auto c = static_cast<unsigned char>(value[pos++]);
+  if (c < 0x80)
+    return c;
+  int extra = (c >= 0xF0) ? 3 : (c >= 0xE0) ? 2 : 1;
+  char32_t codePoint = c & (0x3F >> extra);
+  for (int i = 0; i < extra && pos < size; i++) {
+    codePoint = (codePoint << 6) |
+                (static_cast<unsigned char>(value[pos++]) & 0x3F);
+  }
+  return codePoint;
+}
+
+//! Adds a single UTF-16 code unit to an FNV-1a hash.
+constexpr std::uint32_t
+hashUnit(std::uint32_t hash, std::uint32_t unit)
+{
+  return (hash ^ unit) * 16777619u;
+}
+
+constexpr std::uint32_t HASH_SEED = 2166136261u;
+
+//! \brief Hashes a UTF-8 name as if it were the equivalent UTF-16 string.
+constexpr std::uint32_t
+hashUtf8(const char* value, std::size_t size)
+{
+  std::uint32_t hash = HASH_SEED;
+  std::size_t pos = 0;
+  while (pos < size) {
+    auto codePoint = decodeUtf8(value, size, pos);
+    if (codePoint > 0xFFFF) {
+      codePoint -= 0x10000;
+      hash = hashUnit(hash, 0xD800 + (codePoint >> 10));
+      hash = hashUnit(hash, 0xDC00 + (codePoint & 0x3FF));
+    } else {
+      hash = hashUnit(hash, codePoint);
+    }
+  }
+  return hash;
+}
+
+//! \brief Hashes a UTF-16 string, normally the result of QString::utf16().
+template<typename Unit>
+constexpr std::uint32_t
+hashUtf16(const Unit* units, std::size_t size)
+{
+  std::uint32_t hash = HASH_SEED;
+  for (std::size_t i = 0; i < size; i++) {
+    hash = hashUnit(hash, static_cast<std::uint16_t>(units[i]));
+  }
+  return hash;
+}
+
+//! \brief Compares a UTF-8 name with a UTF-16 string without converting
+//! either of them.
+template<typename Unit>
+constexpr bool
+equalsUtf16(const char* value,
+            std::size_t size,
+            const Unit* units,
+            std::size_t count)
+{
+  std::size_t pos = 0, i = 0;
+  while (pos < size) {
+    auto codePoint = decodeUtf8(value, size, pos);
+    if (codePoint > 0xFFFF) {
+      codePoint -= 0x10000;
+      if (i + 1 >= count ||
+          static_cast<std::uint16_t>(units[i]) != 0xD800 + (codePoint >> 10) ||
+          static_cast<std::uint16_t>(units[i + 1]) !=
+            0xDC00 + (codePoint & 0x3FF))
+        return false;
+      i += 2;
+    } else {
+      if (i >= count || static_cast<std::uint16_t>(units[i]) != codePoint)
+        return false;
+      i++;
+    }
+  }
+  return i == count;
+}
+
+//! Compares two UTF-8 names.
+constexpr bool
+equalsUtf8(const char* a, std::size_t aSize, const char* b, std::size_t bSize)
+{
+  if (aSize != bSize)
+    return false;
+  for (std::size_t i = 0; i < aSize; i++) {
+    if (a[i] != b[i])
+      return false;
+  }
+  return true;
+}
+
+/*!
+  \brief A minimal perfect hash (hash and displace) from a hash to a key.
+
+  Each slot holds the number of the one key that hashes to it, or EMPTY.
+ */
+template<std::size_t BUCKET_COUNT, std::size_t BITS>
+struct PerfectHash
+{
+  std::array<std::uint16_t, BUCKET_COUNT> displacements;
+  std::array<std::int16_t, std::size_t(1) << BITS> entries;
+  bool valid;
+
+  //! The bucket of a hash.
+  static constexpr std::size_t bucketOf(std::uint32_t hash)
+  {
+    return hash % BUCKET_COUNT;
+  }
+
+  //! The slot of a hash after displacement.
+  static constexpr std::size_t slotOf(std::uint32_t hash,
+                                      std::uint32_t displacement)
+  {
+    return ((hash ^ (displacement * 0x9E3779B9u)) * 0x85EBCA6Bu) >>
+           (32 - BITS);
+  }
+
+  //! Returns the only key that could have this hash, or EMPTY.
+  constexpr std::int16_t find(std::uint32_t hash) const
+  {
+    return entries[slotOf(hash, displacements[bucketOf(hash)])];
+  }
+};
+
+/*!
+  \brief Builds a perfect hash over a set of hashed keys.
+
+  equal(i, j) MUST return true if keys i and j have the same value. Only the
+  first of a set of equal keys is placed in the table and firsts[k] is set to
+  that first key for every key k.
+
+  Buckets are placed largest first, while the table is emptiest, each one
+  trying displacements until all of its keys land in empty slots.
+  PerfectHash::valid is false if the table cannot be built, which MUST be
+  checked with a static_assert.
+ */
+template<std::size_t BUCKET_COUNT,
+         std::size_t BITS,
+         std::size_t KEYS,
+         typename Equal>
+constexpr PerfectHash<BUCKET_COUNT, BITS>
+buildPerfectHash(const std::array<std::uint32_t, KEYS>& hashes,
+                 Equal equal,
+                 std::array<std::int16_t, KEYS>& firsts)
+{
+  using Table = PerfectHash<BUCKET_COUNT, BITS>;
+  static_assert(2 * KEYS <= (std::size_t(1) << BITS),
+                "A perfect hash table must be at most half full");
+  static_assert(KEYS <= 0x7FFF, "Too many keys for a perfect hash table");
+
+  Table table{};
+  table.valid = true;
+  for (auto& slot : table.entries)
+    slot = EMPTY;
+
+  // group the keys into buckets, in key order.
+  std::array<std::size_t, BUCKET_COUNT + 1> bucketStart{};
+  for (std::size_t k = 0; k < KEYS; k++) {
+    bucketStart[Table::bucketOf(hashes[k]) + 1]++;
+  }
+  for (std::size_t b = 0; b < BUCKET_COUNT; b++) {
+    bucketStart[b + 1] += bucketStart[b];
+  }
+  std::array<std::size_t, KEYS> members{};
+  std::array<std::size_t, BUCKET_COUNT> sizes{};
+  for (std::size_t k = 0; k < KEYS; k++) {
+    auto b = Table::bucketOf(hashes[k]);
+    members[bucketStart[b] + sizes[b]++] = k;
+  }
+
+  // equal hashes always share a bucket so equal keys only need to be looked
+  // for within a bucket.
+  std::size_t largest = 0;
+  for (std::size_t b = 0; b < BUCKET_COUNT; b++) {
+    std::size_t size = 0;
+    for (auto m = bucketStart[b]; m < bucketStart[b + 1]; m++) {
+      auto k = members[m];
+      firsts[k] = static_cast<std::int16_t>(k);
+      for (auto u = bucketStart[b]; u < bucketStart[b] + size; u++) {
+        auto j = members[u];
+        if (hashes[j] != hashes[k])
+          continue;
+        if (equal(j, k)) {
+          firsts[k] = static_cast<std::int16_t>(j);
+        } else {
+          // two different keys with the same hash can never be separated.
+          table.valid = false;
+          return table;
+        }
+      }
+      if (firsts[k] == static_cast<std::int16_t>(k))
+        members[bucketStart[b] + size++] = k;
+    }
+    sizes[b] = size;
+    if (size > largest)
+      largest = size;
+  }
+  if (largest > MAX_BUCKET_SIZE) {
+    table.valid = false;
+    return table;
+  }
+
+  for (std::size_t size = largest; size > 0; size--) {
+    for (std::size_t b = 0; b < BUCKET_COUNT; b++) {
+      if (sizes[b] != size)
+        continue;
+      bool placed = false;
+      for (std::uint32_t d = 0; d <= MAX_DISPLACEMENT && !placed; d++) {
+        std::array<std::size_t, MAX_BUCKET_SIZE> trial{};
+        placed = true;
+        for (std::size_t m = 0; m < size && placed; m++) {
+          auto slot = Table::slotOf(hashes[members[bucketStart[b] + m]], d);
+          if (table.entries[slot] != EMPTY)
+            placed = false;
+          for (std::size_t t = 0; t < m && placed; t++) {
+            if (trial[t] == slot)
+              placed = false;
+          }
+          trial[m] = slot;
+        }
+        if (placed) {
+          table.displacements[b] = static_cast<std::uint16_t>(d);
+          for (std::size_t m = 0; m < size; m++) {
+            table.entries[trial[m]] =
+              static_cast<std::int16_t>(members[bucketStart[b] + m]);
+          }
+        }
+      }
+      if (!placed) {
+        table.valid = false;
+        return table;
+      }
+    }
+  }
+  return table;
+}
+
+//! The number of name languages, in UNStatisticalCodes::Language order.
+constexpr std::size_t LANGUAGES = 6;
+
+//! The name columns in UNStatisticalCodes::Language order.
+constexpr const char* NAMES[LANGUAGES] = {
+  UNStatisticalData::ENGLISH_NAMES, UNStatisticalData::RUSSIAN_NAMES,
+  UNStatisticalData::CHINESE_NAMES, UNStatisticalData::FRENCH_NAMES,
+  UNStatisticalData::SPANISH_NAMES, UNStatisticalData::ARABIC_NAMES,
+};
+
+//! The name column offsets in UNStatisticalCodes::Language order.
+constexpr const std::uint16_t* NAME_OFFSETS[LANGUAGES] = {
+  UNStatisticalData::ENGLISH_OFFSETS.data(),
+  UNStatisticalData::RUSSIAN_OFFSETS.data(),
+  UNStatisticalData::CHINESE_OFFSETS.data(),
+  UNStatisticalData::FRENCH_OFFSETS.data(),
+  UNStatisticalData::SPANISH_OFFSETS.data(),
+  UNStatisticalData::ARABIC_OFFSETS.data(),
+};
+
+//! Returns the UTF-8 name of M49 table entry i in language lang.
+constexpr const char*
+nameAt(std::size_t lang, std::size_t i)
+{
+  return NAMES[lang] + NAME_OFFSETS[lang][i];
+}
+
+//! Returns the size in bytes of the UTF-8 name of M49 table entry i in
+//! language lang.
+constexpr std::size_t
+nameSize(std::size_t lang, std::size_t i)
+{
+  return std::size_t(NAME_OFFSETS[lang][i + 1] - NAME_OFFSETS[lang][i] - 1);
+}
+
+//! \brief A perfect hash from the names of one language to M49 table index.
+//!
+//! If a name appears more than once in a column the first entry wins, as
+//! it did with QVector::indexOf.
+using NameIndex = PerfectHash<64, 9>;
+
+//! Builds the name index of a single language.
+constexpr NameIndex
+buildNameIndex(std::size_t lang)
+{
+  using UNStatisticalData::COUNT;
+  std::array<std::uint32_t, COUNT> hashes{};
+  for (std::size_t i = 0; i < COUNT; i++) {
+    hashes[i] = hashUtf8(nameAt(lang, i), nameSize(lang, i));
+  }
+  std::array<std::int16_t, COUNT> firsts{};
+  return buildPerfectHash<64, 9>(
+    hashes,
+    [lang](std::size_t a, std::size_t b) {
+      return equalsUtf8(
+        nameAt(lang, a), nameSize(lang, a), nameAt(lang, b), nameSize(lang, b));
+    },
+    firsts);
+}
+
+constexpr NameIndex ENGLISH_INDEX = buildNameIndex(0);
+constexpr NameIndex RUSSIAN_INDEX = buildNameIndex(1);
+constexpr NameIndex CHINESE_INDEX = buildNameIndex(2);
+constexpr NameIndex FRENCH_INDEX = buildNameIndex(3);
+constexpr NameIndex SPANISH_INDEX = buildNameIndex(4);
+constexpr NameIndex ARABIC_INDEX = buildNameIndex(5);
+
+static_assert(ENGLISH_INDEX.valid, "Unable to build the English name index");
+static_assert(RUSSIAN_INDEX.valid, "Unable to build the Russian name index");
+static_assert(CHINESE_INDEX.valid, "Unable to build the Chinese name index");
+static_assert(FRENCH_INDEX.valid, "Unable to build the French name index");
+static_assert(SPANISH_INDEX.valid, "Unable to build the Spanish name index");
+static_assert(ARABIC_INDEX.valid, "Unable to build the Arabic name index");
+
+//! The name indexes in UNStatisticalCodes::Language order.
+constexpr const NameIndex* NAME_INDEXES[LANGUAGES] = {
+  &ENGLISH_INDEX, &RUSSIAN_INDEX, &CHINESE_INDEX,
+  &FRENCH_INDEX,  &SPANISH_INDEX, &ARABIC_INDEX,
+};
+
+//! The number of names in all languages. Name key k is entry k % COUNT in
+//! language k / COUNT.
+constexpr std::size_t NAME_COUNT = LANGUAGES * UNStatisticalData::COUNT;
+
+//! A country or area matched by a name in the global name index.
+struct GlobalMatch
+{
+  //! The M49 table index.
+  std::int16_t index;
+  //! One bit, 1 << UNStatisticalCodes::Language, per language using the name.
+  std::uint8_t languages;
+};
+
+/*!
+  \brief A perfect hash from the names of all six languages to every country
+  or area, and language, using each name.
+
+  The table holds the key of the first use of each distinct name. The matches
+  of that key are held in matches, starting at matchStart[key].
+ */
+struct GlobalNameIndex
+{
+  PerfectHash<512, 12> table;
+  std::array<std::uint16_t, NAME_COUNT> matchStart;
+  std::array<std::uint8_t, NAME_COUNT> matchCount;
+  std::array<GlobalMatch, NAME_COUNT> matches;
+};
+
+//! Builds the global name index.
+constexpr GlobalNameIndex
+buildGlobalNameIndex()
+{
+  using UNStatisticalData::COUNT;
+  GlobalNameIndex index{};
+  std::array<std::uint32_t, NAME_COUNT> hashes{};
+  for (std::size_t k = 0; k < NAME_COUNT; k++) {
+    hashes[k] =
+      hashUtf8(nameAt(k / COUNT, k % COUNT), nameSize(k / COUNT, k % COUNT));
+  }
+  std::array<std::int16_t, NAME_COUNT> firsts{};
+  index.table = buildPerfectHash<512, 12>(
+    hashes,
+    [](std::size_t a, std::size_t b) {
+      return equalsUtf8(nameAt(a / COUNT, a % COUNT),
+                        nameSize(a / COUNT, a % COUNT),
+                        nameAt(b / COUNT, b % COUNT),
+                        nameSize(b / COUNT, b % COUNT));
+    },
+    firsts);
+  if (!index.table.valid)
+    return index;
+
+  // reserve enough room for every use of each distinct name.
+  std::array<std::uint16_t, NAME_COUNT> uses{};
+  for (std::size_t k = 0; k < NAME_COUNT; k++) {
+    uses[std::size_t(firsts[k])]++;
+  }
+  std::uint16_t start = 0;
+  for (std::size_t k = 0; k < NAME_COUNT; k++) {
+    index.matchStart[k] = start;
+    start += uses[k];
+  }
+
+  // merge the uses of a name by the same country or area.
+  for (std::size_t k = 0; k < NAME_COUNT; k++) {
+    auto first = std::size_t(firsts[k]);
+    auto entry = static_cast<std::int16_t>(k % COUNT);
+    auto language = static_cast<std::uint8_t>(1 << (k / COUNT));
+    auto begin = index.matchStart[first];
+    auto end = begin + index.matchCount[first];
+    bool merged = false;
+    for (auto m = begin; m < end && !merged; m++) {
+      if (index.matches[m].index == entry) {
+        index.matches[m].languages |= language;
+        merged = true;
+      }
+    }
+    if (!merged) {
+      index.matches[end] = GlobalMatch{ entry, language };
+      index.matchCount[first]++;
+    }
+  }
+  return index;
+}
+
+constexpr auto GLOBAL_NAME_INDEX = buildGlobalNameIndex();
+
+static_assert(GLOBAL_NAME_INDEX.table.valid,
+              "Unable to build the global name index");
+
+//! The number of possible three digit M49 codes.
+constexpr std::size_t M49_RANGE = 1000;
+
+//! \brief Builds the direct index from M49 code to M49 table index.
+//!
+//! Entries for codes that are not in the table hold EMPTY.
+constexpr std::array<std::int16_t, M49_RANGE>
+buildM49Index()
+{
+  std::array<std::int16_t, M49_RANGE> index{};
+  for (auto& entry : index)
+    entry = EMPTY;
+  for (std::size_t i = 0; i < UNStatisticalData::COUNT; i++)
+    index[UNStatisticalData::M49[i]] = static_cast<std::int16_t>(i);
+  return index;
+}
+
+//! \brief Builds the zero padded three character M49 code strings, "004"
+//! rather than 4, in M49 table order.
+constexpr std::array<std::array<char, 4>, UNStatisticalData::COUNT>
+buildM49Strings()
+{
+  std::array<std::array<char, 4>, UNStatisticalData::COUNT> codes{};
+  for (std::size_t i = 0; i < UNStatisticalData::COUNT; i++) {
+    auto code = UNStatisticalData::M49[i];
+    codes[i][0] = char('0' + code / 100);
+    codes[i][1] = char('0' + (code / 10) % 10);
+    codes[i][2] = char('0' + code % 10);
+    codes[i][3] = '\0';
+  }
+  return codes;
+}
+
+constexpr auto M49_INDEX = buildM49Index();
+constexpr auto M49_STRINGS = buildM49Strings();
+
+//! \brief Packs a three character alpha-3 code into a single integer.
+//!
+//! A packed code is never 0 so 0 is used to mark empty slots.
+template<typename Char>
+constexpr std::uint32_t
+packAlpha3(Char c0, Char c1, Char c2)
+{
+  return (std::uint32_t(c0) << 16) | (std::uint32_t(c1) << 8) |
+         std::uint32_t(c2);
+}
+
+//! The number of slots in the alpha-3 table. MUST be a power of 2.
+constexpr std::size_t ALPHA3_SLOT_BITS = 9;
+constexpr std::size_t ALPHA3_SLOTS = std::size_t(1) << ALPHA3_SLOT_BITS;
+
+static_assert(ALPHA3_SLOTS >= 2 * UNStatisticalData::COUNT,
+              "The alpha-3 table must be at most half full");
+
+//! The home slot of a packed alpha-3 code.
+constexpr std::size_t
+alpha3SlotOf(std::uint32_t packed)
+{
+  return (packed * 0x9E3779B1u) >> (32 - ALPHA3_SLOT_BITS);
+}
+
+//! \brief An open addressed hash from packed alpha-3 code to M49 table index.
+struct Alpha3Index
+{
+  std::array<std::uint32_t, ALPHA3_SLOTS> codes;
+  std::array<std::int16_t, ALPHA3_SLOTS> indexes;
+  bool valid;
+
+  //! Returns the M49 table index of the packed code, or EMPTY.
+  constexpr std::int16_t find(std::uint32_t packed) const
+  {
+    for (auto slot = alpha3SlotOf(packed);; slot = (slot + 1) % ALPHA3_SLOTS) {
+      if (codes[slot] == packed)
+        return indexes[slot];
+      if (codes[slot] == 0)
+        return EMPTY;
+    }
+  }
+};
+
+//! \brief Builds the alpha-3 hash. Areas without an alpha-3 code are skipped.
+//!
+//! Alpha3Index::valid is false if a code appears more than once.
+constexpr Alpha3Index
+buildAlpha3Index()
+{
+  Alpha3Index index{};
+  index.valid = true;
+  for (auto& entry : index.indexes)
+    entry = EMPTY;
+  for (std::size_t i = 0; i < UNStatisticalData::COUNT; i++) {
+    auto& code = UNStatisticalData::ALPHA3[i];
+    if (code[0] == '\0')
+      continue;
+    auto packed = packAlpha3(code[0], code[1], code[2]);
+    auto slot = alpha3SlotOf(packed);
+    while (index.codes[slot] != 0) {
+      if (index.codes[slot] == packed)
+        index.valid = false;
+      slot = (slot + 1) % ALPHA3_SLOTS;
+    }
+    index.codes[slot] = packed;
+    index.indexes[slot] = static_cast<std::int16_t>(i);
+  }
+  return index;
+}
+
+constexpr auto ALPHA3_INDEX = buildAlpha3Index();
+
+static_assert(ALPHA3_INDEX.valid, "Duplicate alpha-3 code in the M49 table");
+
+//! The number of possible two letter alpha-2 codes.
+constexpr std::size_t ALPHA2_RANGE = 26 * 26;
+
+//! \brief Returns the direct index position of a two letter alpha-2 code, or
+//! -1 if the characters are not upper case ASCII letters.
+template<typename Char>
+constexpr int
+alpha2Position(Char c0, Char c1)
+{
+  if (c0 < 'A' || c0 > 'Z' || c1 < 'A' || c1 > 'Z')
+    return -1;
+  return int(c0 - 'A') * 26 + int(c1 - 'A');
+}
+
+/*!
+  \brief The direct index from ISO 3166-1 alpha-2 code to M49 code.
+
+  Codes that are not assigned hold EMPTY. valid is false if a code in the
+  table is not two upper case letters or is listed twice, which is checked
+  with a static_assert.
+*/
+struct Alpha2Index
+{
+  std::array<std::int16_t, ALPHA2_RANGE> m49;
+  bool valid;
+};
+
+constexpr Alpha2Index
+buildAlpha2Index()
+{
+  Alpha2Index index{};
+  index.valid = true;
+  for (auto& entry : index.m49)
+    entry = EMPTY;
+  for (auto& code : UNStatisticalData::ALPHA2_CODES) {
+    auto position = alpha2Position(code.code[0], code.code[1]);
+    if (position < 0 || index.m49[position] != EMPTY) {
+      index.valid = false;
+      continue;
+    }
+    index.m49[position] = static_cast<std::int16_t>(code.m49);
+  }
+  return index;
+}
+
+constexpr auto ALPHA2_INDEX = buildAlpha2Index();
+
+static_assert(ALPHA2_INDEX.valid,
+              "Bad or duplicate alpha-2 code in the ISO 3166 table");
+
+//! The number of M49 regions.
+constexpr std::size_t REGION_COUNT =
+  sizeof(UNStatisticalData::REGIONS) / sizeof(UNStatisticalData::M49Link);
+//! The number of regions that fit in an ancestor bit set.
+constexpr std::size_t MAX_REGIONS = 64;
+
+static_assert(REGION_COUNT <= MAX_REGIONS,
+              "Too many M49 regions for the ancestor bit sets");
+
+/*!
+  \brief The M49 region tree as direct indexes of all 1000 possible codes.
+
+  Every region has a bit number and every code has the set of bits of the
+  regions that contain it, including its own bit if it is a region. Whether a
+  region contains a code is then a single bit test.
+ */
+struct M49Hierarchy
+{
+  //! The ancestor bit number of each region code, or -1.
+  std::array<std::int8_t, M49_RANGE> regionBits;
+  //! The region that immediately contains each code, 0 if there is none.
+  std::array<std::uint16_t, M49_RANGE> parents;
+  //! The bit set of all regions containing each code.
+  std::array<std::uint64_t, M49_RANGE> ancestors;
+  bool valid;
+
+  //! Returns true if the code is a M49 region.
+  constexpr bool isRegion(int code) const
+  {
+    return code >= 0 && code < int(M49_RANGE) && regionBits[code] >= 0;
+  }
+
+  //! Returns true if the code is a region, country or area in the hierarchy.
+  constexpr bool isKnown(int code) const
+  {
+    return code >= 0 && code < int(M49_RANGE) &&
+           (regionBits[code] >= 0 || M49_INDEX[code] >= 0);
+  }
+
+  //! \brief Returns true if code is region or lies within region.
+  constexpr bool contains(int region, int code) const
+  {
+    if (!isRegion(region) || !isKnown(code))
+      return false;
+    return (ancestors[code] >> regionBits[region]) & 1;
+  }
+};
+
+//! \brief Builds the M49 hierarchy from the REGIONS, GROUPINGS and AREAS links.
+//!
+//! M49Hierarchy::valid is false unless every country or area in M49 has
+//! exactly one region and every link points at a known region.
+constexpr M49Hierarchy
+buildM49Hierarchy()
+{
+  using namespace UNStatisticalData;
+  M49Hierarchy hierarchy{};
+  hierarchy.valid = true;
+  for (auto& bit : hierarchy.regionBits)
+    bit = -1;
+
+  std::int8_t bit = 0;
+  for (auto& link : REGIONS) {
+    hierarchy.regionBits[link.code] = bit++;
+    hierarchy.parents[link.code] = link.region;
+  }
+  for (auto& link : REGIONS) {
+    if (link.region != 0 && hierarchy.regionBits[link.region] < 0)
+      hierarchy.valid = false;
+  }
+
+  std::size_t areas = 0;
+  for (auto& link : AREAS) {
+    if (M49_INDEX[link.code] < 0 || hierarchy.parents[link.code] != 0 ||
+        hierarchy.regionBits[link.region] < 0)
+      hierarchy.valid = false;
+    hierarchy.parents[link.code] = link.region;
+    areas++;
+  }
+  if (areas != COUNT)
+    hierarchy.valid = false;
+
+  for (std::size_t code = 0; code < M49_RANGE; code++) {
+    std::uint64_t ancestors = 0;
+    auto current = code;
+    // the depth check stops a badly linked table from looping forever.
+    for (std::size_t depth = 0; current != 0 && depth <= REGION_COUNT;
+         depth++) {
+      if (hierarchy.regionBits[current] >= 0)
+        ancestors |= std::uint64_t(1) << hierarchy.regionBits[current];
+      for (auto& grouping : GROUPINGS) {
+        if (grouping.code == current)
+          ancestors |= std::uint64_t(1)
+                       << hierarchy.regionBits[grouping.region];
+      }
+      current = hierarchy.parents[current];
+    }
+    if (current != 0)
+      hierarchy.valid = false;
+    hierarchy.ancestors[code] = ancestors;
+  }
+  return hierarchy;
+}
+
+constexpr auto M49_HIERARCHY = buildM49Hierarchy();
+
+static_assert(M49_HIERARCHY.valid, "The M49 region hierarchy is incomplete");
+
+} // end of namespace UNStatisticalIndex
+/// \endcond DO_NOT_DOCUMENT
+
+#endif // UNSTATISTICALINDEX_H
@@ -0,0 +1,69 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QTextStream>
+
+#include "registrygenerator.h"
+
+/*
+  Writes a synthetic language subtag registry, scale times the size of the
+  IANA one, to a file or to the standard output.
+*/
+int
+main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("bcp47-registrygen");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription(
+    "Generates synthetic BCP47 language subtag registries.");
+  parser.addHelpOption();
+  QCommandLineOption scaleOption(
+    { "s", "scale" }, "The size relative to the IANA registry.", "scale", "1");
+  QCommandLineOption seedOption(
+    "seed", "Selects one of the registries of the size.", "seed", "1");
+  QCommandLineOption dateOption(
+    "file-date", "The file date, as YYYY-MM-DD.", "date", "2023-08-02");
+  QCommandLineOption outputOption(
+    { "o", "output" }, "The output file, the standard output if not set.",
+    "file");
+  parser.addOption(scaleOption);
+  parser.addOption(seedOption);
+  parser.addOption(dateOption);
+  parser.addOption(outputOption);
+  parser.process(app);
+
+  QTextStream err(stderr);
+  bool scaleOk, seedOk;
+  auto scale = parser.value(scaleOption).toInt(&scaleOk);
+  auto seed = parser.value(seedOption).toUInt(&seedOk);
+  auto fileDate = QDate::fromString(parser.value(dateOption), Qt::ISODate);
+  if (!scaleOk || scale < 1 || !seedOk || !fileDate.isValid()) {
+    err << "The scale, seed or file date is not valid.\n";
+    return 1;
+  }
+
+  QFile file;
+  auto opened = false;
+  if (parser.isSet(outputOption)) {
+    file.setFileName(parser.value(outputOption));
+    opened = file.open(QIODevice::WriteOnly | QIODevice::Truncate);
+  } else {
+    opened = file.open(stdout, QIODevice::WriteOnly);
+  }
+  if (!opened) {
+    err << file.errorString() << "\n";
+    return 1;
+  }
+
+  RegistryGenerator generator(scale, seed);
+  generator.setFileDate(fileDate);
+  auto records = generator.write(&file);
+  if (records < 0) {
+    err << file.errorString() << "\n";
+    return 1;
+  }
+  err << records << " records written.\n";
+  return 0;
+}
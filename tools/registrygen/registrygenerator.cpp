@@ -0,0 +1,419 @@
+#include "registrygenerator.h"
+
+#include <QBuffer>
+#include <QIODevice>
+
+#include <climits>
+
+namespace {
+
+const char* const SYLLABLES[] = {
+  "ka", "lo", "ri", "na", "te", "mu", "si", "ba", "do", "ge", "ha",
+  "ji", "ku", "le", "mo", "ni", "pa", "ro", "sa", "ti", "vu", "wa",
+  "ye", "zu", "an", "el", "in", "or", "ul", "am", "ek", "ut",
+};
+const int SYLLABLE_COUNT = int(sizeof(SYLLABLES) / sizeof(SYLLABLES[0]));
+
+const char* const QUALIFIERS[] = {
+  "Northern", "Southern", "Eastern", "Western", "Central", "Old", "Middle",
+};
+const int QUALIFIER_COUNT = int(sizeof(QUALIFIERS) / sizeof(QUALIFIERS[0]));
+
+//! The number of earlier descriptions that a record may reuse.
+const int RECENT = 256;
+//! The output is written in blocks of about this size.
+const int BLOCK = 1 << 20;
+//! Every macrolanguage is this many languages after the previous one.
+const int MACROLANGUAGE_STEP = 140;
+//! The number of two and three letter language subtags, q is left out of
+//! the three letter ones as qaa..qtz are for private use.
+const int SHORT_LANGUAGES = 676 + 25 * 676;
+
+} // end of anonymous namespace
+
+RegistryGenerator::RegistryGenerator(int scale, quint32 seed)
+  : m_scale(qMax(scale, 1))
+  , m_seed(seed)
+  , m_fileDate(2023, 8, 2)
+{
+}
+
+void
+RegistryGenerator::setFileDate(const QDate& fileDate)
+{
+  m_fileDate = fileDate;
+}
+
+QDate
+RegistryGenerator::fileDate() const
+{
+  return m_fileDate;
+}
+
+QByteArray
+RegistryGenerator::generate()
+{
+  QByteArray data;
+  QBuffer buffer(&data);
+  buffer.open(QIODevice::WriteOnly);
+  write(&buffer);
+  return data;
+}
+
+qint64
+RegistryGenerator::write(QIODevice* device)
+{
+  // the same options always write the same registry.
+  m_state = m_seed ? m_seed : 0x9e3779b9u;
+  m_recent.clear();
+  m_recentNext = 0;
+
+  auto languages = count(LANGUAGES);
+  auto extlangs = count(EXTLANGS, 2414);
+  auto scripts = count(SCRIPTS, 25 * 17576);
+  auto regions = count(REGIONS, 1633);
+  auto variants = count(VARIANTS);
+  auto grandfathered = count(GRANDFATHERED);
+  auto redundant = count(REDUNDANT);
+  auto macrolanguages = qMax(languages / MACROLANGUAGE_STEP, 1);
+  qint64 records = 0;
+
+  QByteArray block;
+  block.reserve(BLOCK + 4096);
+  block += "File-Date: " + m_fileDate.toString(Qt::ISODate).toLatin1() + '\n';
+  auto flush = [device, &block](bool force) {
+    if (!force && block.size() < BLOCK)
+      return true;
+    auto ok = device->write(block) == block.size();
+    block.clear();
+    return ok;
+  };
+  auto begin = [&block, &records](const char* type, const QByteArray& key) {
+    block += "%%\nType: ";
+    block += type;
+    block += key;
+    block += '\n';
+    records++;
+  };
+
+  for (int i = 0; i < languages; i++) {
+    begin("language\nSubtag: ", languageSubtag(i));
+    addDescriptions(block, 15);
+    block += added();
+    if (perMille(30)) {
+      block += "Deprecated: " + added().mid(7);
+      block += "Preferred-Value: " + languageSubtag(below(languages)) + '\n';
+    }
+    if (perMille(17))
+      block += "Suppress-Script: " + scriptSubtag(below(scripts)) + '\n';
+    if (isMacrolanguage(i)) {
+      block += "Scope: macrolanguage\n";
+    } else {
+      auto macrolanguage = i - i % MACROLANGUAGE_STEP + 3;
+      if (macrolanguage > i)
+        macrolanguage -= MACROLANGUAGE_STEP;
+      if (macrolanguage >= 0 && perMille(55))
+        block += "Macrolanguage: " + languageSubtag(macrolanguage) + '\n';
+      if (perMille(14))
+        block += "Scope: collection\n";
+    }
+    if (perMille(20))
+      addComment(block);
+    if (!flush(false))
+      return -1;
+  }
+  begin("language\nSubtag: ", "qaa..qtz");
+  block += "Description: Private use\nAdded: 2005-10-16\nScope: private-use\n";
+
+  for (int i = 0; i < extlangs; i++) {
+    // extlangs share their subtag with a language, and are its preferred
+    // value.
+    auto subtag = languageSubtag(676 + i * 7);
+    auto macrolanguage =
+      languageSubtag((i % macrolanguages) * MACROLANGUAGE_STEP + 3);
+    begin("extlang\nSubtag: ", subtag);
+    addDescriptions(block, 5);
+    block += added();
+    block += "Preferred-Value: " + subtag + '\n';
+    block += "Prefix: " + macrolanguage + '\n';
+    block += "Macrolanguage: " + macrolanguage + '\n';
+    if (!flush(false))
+      return -1;
+  }
+
+  for (int i = 0; i < scripts; i++) {
+    begin("script\nSubtag: ", scriptSubtag(i));
+    addDescriptions(block, 10);
+    block += added();
+    if (perMille(10))
+      addComment(block);
+    if (!flush(false))
+      return -1;
+  }
+  begin("script\nSubtag: ", "Qaaa..Qabx");
+  block += "Description: Private use\nAdded: 2005-10-16\n";
+
+  for (int i = 0; i < regions; i++) {
+    begin("region\nSubtag: ", regionSubtag(i));
+    addDescriptions(block, 10);
+    block += added();
+    if (perMille(30)) {
+      block += "Deprecated: " + added().mid(7);
+      block += "Preferred-Value: " + regionSubtag(below(regions)) + '\n';
+    }
+    if (perMille(20))
+      addComment(block);
+    if (!flush(false))
+      return -1;
+  }
+  for (auto range : { "AA", "QM..QZ", "XA..XZ", "ZZ" }) {
+    begin("region\nSubtag: ", range);
+    block += "Description: Private use\nAdded: 2005-10-16\n";
+  }
+
+  for (int i = 0; i < variants; i++) {
+    begin("variant\nSubtag: ", variantSubtag(i));
+    addDescriptions(block, 5);
+    block += added();
+    // most variants may only follow particular languages or scripts.
+    auto prefixes = perMille(250) ? 0 : 1 + below(3);
+    for (int p = 0; p < prefixes; p++) {
+      block += "Prefix: " + languageSubtag(below(SHORT_LANGUAGES));
+      if (perMille(200))
+        block += '-' + scriptSubtag(below(scripts));
+      block += '\n';
+    }
+    if (perMille(150))
+      addComment(block);
+    if (!flush(false))
+      return -1;
+  }
+
+  for (int i = 0; i < grandfathered; i++) {
+    begin("grandfathered\nTag: ", "i-" + letters(i, 5 + i % 4));
+    addDescriptions(block, 0);
+    block += added();
+    if (perMille(800)) {
+      block += "Deprecated: " + added().mid(7);
+      block += "Preferred-Value: " + languageSubtag(below(languages)) + '\n';
+    }
+    if (!flush(false))
+      return -1;
+  }
+
+  for (int i = 0; i < redundant; i++) {
+    // each tag has its own language, so no two are the same.
+    auto tag = languageSubtag(i) + '-' + scriptSubtag(i % scripts);
+    if (i % 3 == 0)
+      tag += '-' + regionSubtag(i % regions);
+    begin("redundant\nTag: ", tag);
+    addDescriptions(block, 0);
+    block += added();
+    if (perMille(300)) {
+      block += "Deprecated: " + added().mid(7);
+      block += "Preferred-Value: " + languageSubtag(below(languages)) + '\n';
+    }
+    if (!flush(false))
+      return -1;
+  }
+
+  if (!flush(true))
+    return -1;
+  return records;
+}
+
+quint32
+RegistryGenerator::next()
+{
+  // xorshift, which unlike the standard distributions gives the same
+  // numbers with every compiler.
+  m_state ^= m_state << 13;
+  m_state ^= m_state >> 17;
+  m_state ^= m_state << 5;
+  return m_state;
+}
+
+int
+RegistryGenerator::below(int limit)
+{
+  return limit > 0 ? int(next() % quint32(limit)) : 0;
+}
+
+bool
+RegistryGenerator::perMille(int chance)
+{
+  return below(1000) < chance;
+}
+
+QByteArray
+RegistryGenerator::word()
+{
+  QByteArray value;
+  auto syllables = 2 + below(3);
+  for (int i = 0; i < syllables; i++)
+    value += SYLLABLES[below(SYLLABLE_COUNT)];
+  // a few names are not plain ASCII.
+  if (perMille(15))
+    value.replace(value.size() - 1, 1, "\xc3\xa9");
+  value[0] = char(value.at(0) - 'a' + 'A');
+  return value;
+}
+
+QByteArray
+RegistryGenerator::description()
+{
+  auto value = word();
+  auto form = below(1000);
+  if (form < 80)
+    value = QByteArray(QUALIFIERS[below(QUALIFIER_COUNT)]) + ' ' + value;
+  else if (form < 100)
+    value += " Sign Language";
+  else if (form < 120)
+    value += '-' + word();
+  else if (form < 130)
+    value += " (" + word() + ')';
+  return value;
+}
+
+QByteArray
+RegistryGenerator::added()
+{
+  // most of the registry was added with the first two versions.
+  auto form = below(1000);
+  QDate date(2005, 10, 16);
+  if (form >= 700 && form < 900)
+    date = QDate(2009, 7, 29);
+  else if (form >= 900)
+    date = date.addDays(below(int(date.daysTo(m_fileDate)) + 1));
+  return "Added: " + date.toString(Qt::ISODate).toLatin1() + '\n';
+}
+
+void
+RegistryGenerator::addDescriptions(QByteArray& record, int reuse)
+{
+  // about one record in fourteen has more than one description, and some
+  // descriptions are shared between records.
+  auto count = 1;
+  if (perMille(70))
+    count += perMille(150) ? 2 : 1;
+  for (int i = 0; i < count; i++) {
+    QByteArray value;
+    if (!m_recent.isEmpty() && perMille(reuse)) {
+      value = m_recent.at(below(m_recent.size()));
+    } else {
+      value = description();
+      if (m_recent.size() < RECENT)
+        m_recent.append(value);
+      else
+        m_recent[m_recentNext++ % RECENT] = value;
+    }
+    record += "Description: " + value + '\n';
+  }
+}
+
+void
+RegistryGenerator::addComment(QByteArray& record)
+{
+  // a long comment runs over onto indented lines.
+  auto lines = perMille(300) ? 2 + below(2) : 1;
+  record += "Comments:";
+  for (int line = 0; line < lines; line++) {
+    if (line > 0)
+      record += "\n ";
+    auto words = 6 + below(9);
+    for (int i = 0; i < words; i++)
+      record += ' ' + word().toLower();
+  }
+  record += '\n';
+}
+
+int
+RegistryGenerator::count(BaseCount base, int limit) const
+{
+  auto value = qint64(base) * m_scale;
+  if (limit >= 0 && value > limit)
+    value = limit;
+  return int(qMin(value, qint64(INT_MAX)));
+}
+
+QByteArray
+RegistryGenerator::letters(int index, int length)
+{
+  QByteArray value(length, 'a');
+  for (int i = length - 1; i >= 0; i--) {
+    value[i] = char('a' + index % 26);
+    index /= 26;
+  }
+  return value;
+}
+
+QByteArray
+RegistryGenerator::languageSubtag(int index)
+{
+  if (index < 676)
+    return letters(index, 2);
+  index -= 676;
+  if (index < 25 * 676) {
+    auto first = index / 676;
+    auto value = letters(index % 676, 2);
+    value.prepend(char('a' + first + (first >= 'q' - 'a' ? 1 : 0)));
+    return value;
+  }
+  // then on to the five to eight letter subtags.
+  index -= 25 * 676;
+  auto length = 5;
+  for (qint64 size = 26 * 26 * 26 * 26 * 26; index >= size && length < 8;
+       size *= 26) {
+    index -= int(size);
+    length++;
+  }
+  return letters(index, length);
+}
+
+QByteArray
+RegistryGenerator::scriptSubtag(int index)
+{
+  // Q is left out, Qaaa..Qabx are for private use.
+  auto first = index / 17576;
+  auto value = letters(index % 17576, 3);
+  value.prepend(char('A' + first + (first >= 'Q' - 'A' ? 1 : 0)));
+  return value;
+}
+
+QByteArray
+RegistryGenerator::regionSubtag(int index)
+{
+  // the two letter regions, without those for private use, then the three
+  // digit ones.
+  static const QVector<QByteArray> alpha = []() {
+    QVector<QByteArray> values;
+    for (char first = 'A'; first <= 'Z'; first++) {
+      for (char second = 'A'; second <= 'Z'; second++) {
+        if ((first == 'A' && second == 'A') ||
+            (first == 'Q' && second >= 'M') || first == 'X' ||
+            (first == 'Z' && second == 'Z'))
+          continue;
+        values.append(QByteArray(1, first) + second);
+      }
+    }
+    return values;
+  }();
+  if (index < alpha.size())
+    return alpha.at(index);
+  return QByteArray::number(index - alpha.size() + 1).rightJustified(3, '0');
+}
+
+QByteArray
+RegistryGenerator::variantSubtag(int index)
+{
+  // a four character variant must start with a digit, like 1901.
+  if (index % 8 == 0 && index / 8 < 9000)
+    return QByteArray::number(1000 + index / 8);
+  return letters(index, 5 + index % 4);
+}
+
+bool
+RegistryGenerator::isMacrolanguage(int index)
+{
+  return index % MACROLANGUAGE_STEP == 3;
+}
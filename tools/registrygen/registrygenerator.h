@@ -0,0 +1,89 @@
+#ifndef REGISTRYGENERATOR_H
+#define REGISTRYGENERATOR_H
+
+#include <QByteArray>
+#include <QDate>
+#include <QVector>
+
+class QIODevice;
+
+/*!
+  \class RegistryGenerator registrygenerator.h
+  \brief Writes synthetic language subtag registries of any size.
+
+  The output has the syntax of the IANA registry and, at a scale of one, about
+  as many records of each type as the real one. Larger scales multiply every
+  type, so that parsing, loading, saving and lookups can be measured as the
+  registry grows. Records are built from their index, so nothing is held in
+  memory and the same options always give the same registry.
+
+  The proportions of the real registry are kept: some records have several
+  descriptions, some descriptions are shared by several records, extlangs and
+  variants have prefixes, and some records are deprecated, have a preferred
+  value, a macrolanguage, a suppressed script, a scope or a comment, which may
+  run over several lines.
+
+  Every subtag is well formed, so the types that have few possible subtags
+  stop growing once they are used up. Two letter and numeric regions stop at
+  1633 and three letter extlangs at 2414. Languages move on from two and three
+  letter subtags to five letter subtags.
+ */
+class RegistryGenerator
+{
+public:
+  //! The number of records of each type at a scale of one.
+  enum BaseCount
+  {
+    LANGUAGES = 8240,
+    EXTLANGS = 252,
+    SCRIPTS = 219,
+    REGIONS = 304,
+    VARIANTS = 118,
+    GRANDFATHERED = 26,
+    REDUNDANT = 67,
+  };
+
+  //! Constructs a generator for a registry scale times the size of the real
+  //! one. The seed selects one of the possible registries of that size.
+  explicit RegistryGenerator(int scale = 1, quint32 seed = 1);
+
+  //! Sets the file date, by default 2023-08-02.
+  void setFileDate(const QDate& fileDate);
+  //! Returns the file date.
+  QDate fileDate() const;
+
+  //! Writes the registry to device and returns the number of records, or -1
+  //! if it could not be written.
+  qint64 write(QIODevice* device);
+
+  //! Returns the registry as a single array.
+  QByteArray generate();
+
+private:
+  int m_scale;
+  quint32 m_seed;
+  quint32 m_state = 0;
+  QDate m_fileDate;
+  QVector<QByteArray> m_recent;
+  int m_recentNext = 0;
+
+  quint32 next();
+  int below(int limit);
+  bool perMille(int chance);
+
+  QByteArray word();
+  QByteArray description();
+  QByteArray added();
+  void addDescriptions(QByteArray& record, int reuse);
+  void addComment(QByteArray& record);
+
+  int count(BaseCount base, int limit = -1) const;
+  static QByteArray letters(int index, int length);
+  static QByteArray languageSubtag(int index);
+  static QByteArray scriptSubtag(int index);
+  static QByteArray regionSubtag(int index);
+  static QByteArray variantSubtag(int index);
+  static bool isMacrolanguage(int index);
+};
+
+#endif // REGISTRYGENERATOR_H